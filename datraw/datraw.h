@@ -8,14 +8,20 @@
 #define _DATRAW_H
 #pragma once
 
+#include "datraw/access_pattern.h"
 #include "datraw/convert.h"
+#include "datraw/default_init_allocator.h"
 #include "datraw/endianness.h"
+#include "datraw/frame_view.h"
 #include "datraw/half.h"
 #include "datraw/info.h"
 #include "datraw/literal.h"
+#include "datraw/lookup_table.h"
+#include "datraw/prefetching_raw_reader.h"
 #include "datraw/raw_reader.h"
 #include "datraw/scalar_type.h"
 #include "datraw/types.h"
 #include "datraw/variant.h"
+#include "datraw/visit_scalar.h"
 
 #endif /* !defined(_DATRAW_H) */
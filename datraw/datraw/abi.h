@@ -1,5 +1,5 @@
 ﻿// <copyright file="abi.h" company="Visualisierungsinstitut der Universität Stuttgart">
-// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Copyright © 2025 - 2026 Visualisierungsinstitut der Universität Stuttgart.
 // Licensed under the MIT licence. See LICENCE file for details.
 // </copyright>
 // <author>Christoph Müller</author>
@@ -10,7 +10,7 @@
 
 
 #define DATRAW_ABI_MAJOR 1
-#define DATRAW_ABI_MINOR 2
+#define DATRAW_ABI_MINOR 3
 
 
 #define _DATRAW_CONCAT0(l, r) l ## r
@@ -0,0 +1,53 @@
+﻿// <copyright file="access_pattern.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2026 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_DATRAW_ACCESS_PATTERN_H)
+#define _DATRAW_ACCESS_PATTERN_H
+#pragma once
+
+#include "datraw/abi.h"
+
+
+DATRAW_NAMESPACE_BEGIN
+
+/// <summary>
+/// Describes how an application accesses the raw files, which allows the
+/// operating system to optimise its caching and readahead.
+/// </summary>
+enum class access_pattern {
+
+    /// <summary>
+    /// Nothing is known about the access pattern, ie the default heuristics
+    /// of the operating system are used.
+    /// </summary>
+    normal = 0,
+
+    /// <summary>
+    /// The time steps are played back one after the other and each of them
+    /// is read from begin to end.
+    /// </summary>
+    /// <remarks>
+    /// In this mode, the operating system reads ahead aggressively and the
+    /// pages of time steps that have been consumed are released from the
+    /// page cache.
+    /// </remarks>
+    sequential,
+
+    /// <summary>
+    /// Whole time steps are accessed in an unpredictable order.
+    /// </summary>
+    random,
+
+    /// <summary>
+    /// Only parts of the time steps like regions or slices are read, ie
+    /// reading ahead is most likely wasted.
+    /// </summary>
+    region
+};
+
+DATRAW_NAMESPACE_END
+
+#endif /* !defined(_DATRAW_ACCESS_PATTERN_H) */
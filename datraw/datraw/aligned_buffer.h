@@ -0,0 +1,150 @@
+﻿// <copyright file="aligned_buffer.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2026 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_DATRAW_ALIGNED_BUFFER_H)
+#define _DATRAW_ALIGNED_BUFFER_H
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#if defined(_WIN32)
+#include <malloc.h>
+#endif /* defined(_WIN32) */
+
+#include "datraw/abi.h"
+#include "datraw/types.h"
+
+
+DATRAW_DETAIL_NAMESPACE_BEGIN
+
+/// <summary>
+/// An uninitialised block of heap memory with a specific alignment, as it is
+/// required for unbuffered I/O.
+/// </summary>
+class aligned_buffer final {
+
+public:
+
+    /// <summary>
+    /// The type to express sizes and alignments.
+    /// </summary>
+    typedef std::size_t size_type;
+
+    /// <summary>
+    /// Initialises a new, empty instance.
+    /// </summary>
+    inline aligned_buffer(void) noexcept : buffer(nullptr), length(0) { }
+
+    /// <summary>
+    /// Allocates <paramref name="size" /> bytes aligned to
+    /// <paramref name="alignment" />.
+    /// </summary>
+    /// <param name="size">The size of the buffer in bytes.</param>
+    /// <param name="alignment">The alignment of the buffer, which must be a
+    /// power of two and a multiple of <c>sizeof(void *)</c>.</param>
+    /// <exception cref="std::bad_alloc">If the memory could not be
+    /// allocated.</exception>
+    inline aligned_buffer(const size_type size, const size_type alignment)
+            : buffer(nullptr), length(size) {
+#if defined(_WIN32)
+        this->buffer = ::_aligned_malloc(size, alignment);
+#else /* defined(_WIN32) */
+        if (::posix_memalign(&this->buffer, alignment, size) != 0) {
+            this->buffer = nullptr;
+        }
+#endif /* defined(_WIN32) */
+
+        if (this->buffer == nullptr) {
+            throw std::bad_alloc();
+        }
+    }
+
+    aligned_buffer(const aligned_buffer&) = delete;
+
+    /// <summary>
+    /// Move <paramref name="rhs" /> into a new instance.
+    /// </summary>
+    /// <param name="rhs">The object to be moved.</param>
+    inline aligned_buffer(aligned_buffer&& rhs) noexcept
+            : buffer(rhs.buffer), length(rhs.length) {
+        rhs.buffer = nullptr;
+        rhs.length = 0;
+    }
+
+    /// <summary>
+    /// Finalises the instance.
+    /// </summary>
+    inline ~aligned_buffer(void) noexcept {
+        this->release();
+    }
+
+    /// <summary>
+    /// Answer a pointer to the begin of the buffer.
+    /// </summary>
+    /// <returns>The begin of the buffer.</returns>
+    inline datraw::uint8 *data(void) const noexcept {
+        return static_cast<datraw::uint8 *>(this->buffer);
+    }
+
+    /// <summary>
+    /// Frees the memory, if any.
+    /// </summary>
+    inline void release(void) noexcept {
+        if (this->buffer != nullptr) {
+#if defined(_WIN32)
+            ::_aligned_free(this->buffer);
+#else /* defined(_WIN32) */
+            ::free(this->buffer);
+#endif /* defined(_WIN32) */
+            this->buffer = nullptr;
+            this->length = 0;
+        }
+    }
+
+    /// <summary>
+    /// Answer the size of the buffer in bytes.
+    /// </summary>
+    /// <returns>The size of the buffer.</returns>
+    inline size_type size(void) const noexcept {
+        return this->length;
+    }
+
+    aligned_buffer& operator =(const aligned_buffer&) = delete;
+
+    /// <summary>
+    /// Move assignment.
+    /// </summary>
+    /// <param name="rhs">The object to be moved.</param>
+    /// <returns><c>*this</c>.</returns>
+    inline aligned_buffer& operator =(aligned_buffer&& rhs) noexcept {
+        if (this != &rhs) {
+            this->release();
+            this->buffer = rhs.buffer;
+            this->length = rhs.length;
+            rhs.buffer = nullptr;
+            rhs.length = 0;
+        }
+        return *this;
+    }
+
+private:
+
+    /// <summary>
+    /// The memory.
+    /// </summary>
+    void *buffer;
+
+    /// <summary>
+    /// The size of <see cref="buffer" /> in bytes.
+    /// </summary>
+    size_type length;
+};
+
+DATRAW_DETAIL_NAMESPACE_END
+
+#endif /* !defined(_DATRAW_ALIGNED_BUFFER_H) */
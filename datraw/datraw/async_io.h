@@ -0,0 +1,421 @@
+﻿// <copyright file="async_io.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2026 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_DATRAW_ASYNC_IO_H)
+#define _DATRAW_ASYNC_IO_H
+#pragma once
+
+#include <atomic>
+#include <cinttypes>
+#include <condition_variable>
+#include <cstddef>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#if !defined(DATRAW_NO_IO_URING) && defined(__linux__) \
+    && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#define DATRAW_WITH_IO_URING
+#endif /* __has_include(<linux/io_uring.h>) */
+#endif /* !defined(DATRAW_NO_IO_URING) && defined(__linux__) ... */
+
+#if defined(DATRAW_WITH_IO_URING)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif /* defined(DATRAW_WITH_IO_URING) */
+
+#include "datraw/file.h"
+#include "datraw/parallel.h"
+#include "datraw/thread_pool.h"
+#include "datraw/types.h"
+
+
+DATRAW_DETAIL_NAMESPACE_BEGIN
+
+/// <summary>
+/// Executes reads from raw files asynchronously.
+/// </summary>
+/// <remarks>
+/// <para>On Linux, the reads are issued via io_uring if the kernel supports
+/// it, ie a single thread waits for the completion of all reads in flight.
+/// Otherwise, the reads are executed by a fixed pool of threads.</para>
+/// <para>Large reads are split into segments of at most
+/// <see cref="segment_size" /> bytes, which are processed independently.
+/// </para>
+/// <para>The io_uring backend hands the completed segments over to the
+/// process-wide <see cref="thread_pool" />, ie the thread waiting for
+/// completions never runs user code.</para>
+/// <para>The class is thread-safe.</para>
+/// </remarks>
+class async_io final {
+
+public:
+
+    /// <summary>
+    /// Possible implementations of the asynchronous reads.
+    /// </summary>
+    enum class backend_type {
+        /// <summary>
+        /// A pool of threads performs synchronous reads.
+        /// </summary>
+        thread_pool,
+
+        /// <summary>
+        /// The reads are submitted to the Linux io_uring interface.
+        /// </summary>
+        io_uring
+    };
+
+    /// <summary>
+    /// The type of the callback which is invoked once all reads of a
+    /// request have completed.
+    /// </summary>
+    /// <remarks>
+    /// The callback receives the first error that occurred or
+    /// <c>nullptr</c> if all reads succeeded. It is invoked on a thread of
+    /// the backend or the <see cref="thread_pool" /> and must neither throw
+    /// nor submit new requests.
+    /// </remarks>
+    typedef std::function<void(std::exception_ptr)> completion_type;
+
+    /// <summary>
+    /// The type of the optional callback which is invoked for each segment
+    /// of data once it has been read successfully.
+    /// </summary>
+    /// <remarks>
+    /// The callback receives the begin and the size of the segment in the
+    /// destination buffer. Callbacks for different segments of the same
+    /// request may run concurrently. If the callback throws, the exception
+    /// is passed to the <see cref="completion_type" /> of the request.
+    /// </remarks>
+    typedef std::function<void(void *, std::size_t)> process_type;
+
+    /// <summary>
+    /// The type to express sizes of reads.
+    /// </summary>
+    typedef std::size_t size_type;
+
+    /// <summary>
+    /// A single read from a file.
+    /// </summary>
+    struct read_type {
+        std::uint64_t offset;
+        void *dst;
+        size_type size;
+    };
+
+    /// <summary>
+    /// A request for reading one or more ranges of the same file, which
+    /// completes once all reads have completed.
+    /// </summary>
+    struct request_type {
+        std::shared_ptr<const file> source;
+        std::vector<read_type> reads;
+        completion_type completion;
+        process_type process;
+    };
+
+    /// <summary>
+    /// Answer the instance shared by all readers.
+    /// </summary>
+    /// <returns>The process-wide instance.</returns>
+    static inline async_io& instance(void) {
+        static async_io retval;
+        return retval;
+    }
+
+    /// <summary>
+    /// Answer the instance shared by all readers for files opened for
+    /// direct I/O, which always uses the thread pool.
+    /// </summary>
+    /// <remarks>
+    /// The reads of the thread pool are aligned by the
+    /// <see cref="file" /> itself, which is why it is used for direct I/O.
+    /// </remarks>
+    /// <returns>The process-wide instance for direct I/O.</returns>
+    static inline async_io& direct_instance(void) {
+        static async_io retval(false);
+        return retval;
+    }
+
+    /// <summary>
+    /// The maximum number of bytes read by a single operation.
+    /// </summary>
+    static inline constexpr size_type segment_size(void) noexcept {
+        return 64 * 1024 * 1024;
+    }
+
+    /// <summary>
+    /// Initialises a new instance.
+    /// </summary>
+    /// <param name="allowUring">If <c>true</c>, io_uring is used if
+    /// available. Otherwise, the thread pool is used in any case.</param>
+    /// <param name="threads">The number of threads in the pool if the pool
+    /// is used. If this is zero, the number of hardware threads is used.
+    /// </param>
+    inline explicit async_io(const bool allowUring = true,
+        const size_type threads = 0);
+
+    async_io(const async_io&) = delete;
+
+    /// <summary>
+    /// Finalises the instance.
+    /// </summary>
+    /// <remarks>
+    /// The destructor blocks until all reads in flight have completed.
+    /// </remarks>
+    inline ~async_io(void);
+
+    /// <summary>
+    /// Answer the implementation that is used.
+    /// </summary>
+    /// <returns>The backend of the instance.</returns>
+    inline backend_type backend(void) const noexcept {
+        return this->type;
+    }
+
+    /// <summary>
+    /// Submits a batch of requests.
+    /// </summary>
+    /// <remarks>
+    /// <para>The method returns as soon as all reads have been queued. If
+    /// too many reads are in flight, it might block until some of them have
+    /// completed.</para>
+    /// <para>The destination buffers must remain valid until the completion
+    /// callback of the respective request has been invoked.</para>
+    /// </remarks>
+    /// <param name="requests">The requests to be submitted.</param>
+    /// <exception cref="std::runtime_error">If the reads could not be
+    /// submitted to the operating system.</exception>
+    inline void submit(std::vector<request_type>&& requests);
+
+    /// <summary>
+    /// Submits a single request.
+    /// </summary>
+    /// <param name="request">The request to be submitted.</param>
+    /// <exception cref="std::runtime_error">If the reads could not be
+    /// submitted to the operating system.</exception>
+    inline void submit(request_type&& request) {
+        std::vector<request_type> requests;
+        requests.push_back(std::move(request));
+        this->submit(std::move(requests));
+    }
+
+    async_io& operator =(const async_io&) = delete;
+
+private:
+
+    /// <summary>
+    /// The shared state of all segments of a request.
+    /// </summary>
+    struct state_type {
+        completion_type completion;
+        std::exception_ptr error;
+        std::mutex lock;
+        std::atomic<size_type> pending;
+        process_type process;
+        std::shared_ptr<const file> source;
+    };
+
+    /// <summary>
+    /// A single operation, which is a part of a request.
+    /// </summary>
+    struct segment_type {
+        size_type done;
+        datraw::uint8 *dst;
+        std::uint64_t offset;
+        size_type size;
+        std::shared_ptr<state_type> state;
+#if defined(DATRAW_WITH_IO_URING)
+        struct iovec vec;
+#endif /* defined(DATRAW_WITH_IO_URING) */
+    };
+
+    /// <summary>
+    /// Processes the data of <paramref name="segment" />, records its
+    /// completion and invokes the completion callback if it was the last one
+    /// of its request.
+    /// </summary>
+    static inline void complete(std::unique_ptr<segment_type>&& segment,
+        std::exception_ptr error) noexcept;
+
+    /// <summary>
+    /// Reads <paramref name="segment" /> on a thread of the pool and
+    /// completes it.
+    /// </summary>
+    inline void read_pool(segment_type *segment) noexcept;
+
+#if defined(DATRAW_WITH_IO_URING)
+    /// <summary>
+    /// Releases all resources of the ring.
+    /// </summary>
+    inline void close_uring(void) noexcept;
+
+    /// <summary>
+    /// Tells the kernel about all queued submissions.
+    /// </summary>
+    /// <remarks>
+    /// The caller must hold <see cref="lock" />.
+    /// </remarks>
+    inline void flush_uring(void);
+
+    /// <summary>
+    /// Tries to create the ring.
+    /// </summary>
+    inline bool open_uring(void) noexcept;
+
+    /// <summary>
+    /// Queues a read of <paramref name="segment" /> or a no-op if
+    /// <paramref name="segment" /> is <c>nullptr</c>.
+    /// </summary>
+    /// <remarks>
+    /// The caller must hold <see cref="lock" />.
+    /// </remarks>
+    inline void queue_uring(segment_type *segment);
+
+    /// <summary>
+    /// The work loop of the thread waiting for completions.
+    /// </summary>
+    inline void run_uring(void);
+
+    /// <summary>
+    /// The head of the completion queue.
+    /// </summary>
+    unsigned *cqHead;
+
+    /// <summary>
+    /// The mask for indices into the completion queue.
+    /// </summary>
+    unsigned cqMask;
+
+    /// <summary>
+    /// The entries of the completion queue.
+    /// </summary>
+    struct io_uring_cqe *cqes;
+
+    /// <summary>
+    /// The tail of the completion queue.
+    /// </summary>
+    unsigned *cqTail;
+
+    /// <summary>
+    /// The mapping of the completion queue, unless it is shared with the
+    /// submission queue.
+    /// </summary>
+    void *cqRing;
+
+    /// <summary>
+    /// The size of <see cref="cqRing" />.
+    /// </summary>
+    size_type cqRingSize;
+
+    /// <summary>
+    /// The file descriptor of the ring.
+    /// </summary>
+    int ringFd;
+
+    /// <summary>
+    /// The indirection array of the submission queue.
+    /// </summary>
+    unsigned *sqArray;
+
+    /// <summary>
+    /// The number of entries in the submission queue.
+    /// </summary>
+    unsigned sqEntries;
+
+    /// <summary>
+    /// The head of the submission queue.
+    /// </summary>
+    unsigned *sqHead;
+
+    /// <summary>
+    /// The mask for indices into the submission queue.
+    /// </summary>
+    unsigned sqMask;
+
+    /// <summary>
+    /// The mapping of the submission queue.
+    /// </summary>
+    void *sqRing;
+
+    /// <summary>
+    /// The size of <see cref="sqRing" />.
+    /// </summary>
+    size_type sqRingSize;
+
+    /// <summary>
+    /// The entries of the submission queue.
+    /// </summary>
+    struct io_uring_sqe *sqes;
+
+    /// <summary>
+    /// The size of the mapping of <see cref="sqes" />.
+    /// </summary>
+    size_type sqesSize;
+
+    /// <summary>
+    /// The tail of the submission queue.
+    /// </summary>
+    unsigned *sqTail;
+#endif /* defined(DATRAW_WITH_IO_URING) */
+
+    /// <summary>
+    /// Signals changes of <see cref="inFlight" />.
+    /// </summary>
+    std::condition_variable condition;
+
+    /// <summary>
+    /// The number of segments being processed by the kernel or waiting for
+    /// or being processed by the pool.
+    /// </summary>
+    size_type inFlight;
+
+    /// <summary>
+    /// Protects the state of the backend.
+    /// </summary>
+    std::mutex lock;
+
+    /// <summary>
+    /// The maximum number of segments being processed by the kernel.
+    /// </summary>
+    size_type maxInFlight;
+
+    /// <summary>
+    /// The threads performing synchronous reads if the thread pool is used.
+    /// </summary>
+    /// <remarks>
+    /// The pool must be destroyed before <see cref="condition" /> and
+    /// <see cref="lock" />, which its threads use until they exit.
+    /// </remarks>
+    std::unique_ptr<thread_pool> pool;
+
+    /// <summary>
+    /// The thread waiting for completions if io_uring is used.
+    /// </summary>
+    std::vector<std::thread> threads;
+
+    /// <summary>
+    /// The implementation in use.
+    /// </summary>
+    backend_type type;
+};
+
+DATRAW_DETAIL_NAMESPACE_END
+
+#include "datraw/async_io.inl"
+
+#endif /* !defined(_DATRAW_ASYNC_IO_H) */
@@ -0,0 +1,470 @@
+﻿// <copyright file="async_io.inl" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2026 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+
+/*
+ * DATRAW_DETAIL_NAMESPACE::async_io::async_io
+ */
+DATRAW_DETAIL_NAMESPACE::async_io::async_io(const bool allowUring,
+        const size_type threads)
+        : inFlight(0), maxInFlight(0), type(backend_type::thread_pool) {
+#if defined(DATRAW_WITH_IO_URING)
+    if (allowUring && this->open_uring()) {
+        try {
+            // The completions are processed by the shared pool, which
+            // therefore must be destroyed after this instance.
+            thread_pool::instance();
+
+            this->type = backend_type::io_uring;
+            this->threads.emplace_back(&async_io::run_uring, this);
+            return;
+        } catch (...) {
+            this->close_uring();
+            this->type = backend_type::thread_pool;
+        }
+    }
+#endif /* defined(DATRAW_WITH_IO_URING) */
+
+    const auto cnt = effective_concurrency(threads,
+        (std::numeric_limits<size_type>::max)());
+    this->maxInFlight = (std::numeric_limits<size_type>::max)();
+    this->pool.reset(new thread_pool(cnt));
+}
+
+
+/*
+ * DATRAW_DETAIL_NAMESPACE::async_io::~async_io
+ */
+DATRAW_DETAIL_NAMESPACE::async_io::~async_io(void) {
+    {
+        std::unique_lock<std::mutex> l(this->lock);
+        this->condition.wait(l, [this](void) {
+            return (this->inFlight == 0);
+        });
+
+#if defined(DATRAW_WITH_IO_URING)
+        if (this->type == backend_type::io_uring) {
+            // Wake the completion thread with a no-op, which tells it to
+            // exit.
+            try {
+                this->queue_uring(nullptr);
+                this->flush_uring();
+            } catch (...) {
+                // We cannot do anything about this, but the thread will
+                // hang if we try to join it.
+                for (auto& t : this->threads) {
+                    t.detach();
+                }
+                this->threads.clear();
+            }
+        }
+#endif /* defined(DATRAW_WITH_IO_URING) */
+    }
+
+    for (auto& t : this->threads) {
+        t.join();
+    }
+
+#if defined(DATRAW_WITH_IO_URING)
+    if (this->type == backend_type::io_uring) {
+        this->close_uring();
+    }
+#endif /* defined(DATRAW_WITH_IO_URING) */
+}
+
+
+/*
+ * DATRAW_DETAIL_NAMESPACE::async_io::submit
+ */
+void DATRAW_DETAIL_NAMESPACE::async_io::submit(
+        std::vector<request_type>&& requests) {
+    std::vector<std::unique_ptr<segment_type>> segments;
+
+    // Split all requests into segments, which are then processed
+    // independently.
+    for (auto& r : requests) {
+        auto state = std::make_shared<state_type>();
+        state->completion = std::move(r.completion);
+        state->process = std::move(r.process);
+        state->source = std::move(r.source);
+        state->pending = 0;
+
+        for (auto& d : r.reads) {
+            auto dst = static_cast<datraw::uint8 *>(d.dst);
+            for (size_type o = 0; o < d.size; o += async_io::segment_size()) {
+                std::unique_ptr<segment_type> s(new segment_type());
+                s->done = 0;
+                s->dst = dst + o;
+                s->offset = d.offset + o;
+                s->size = (std::min)(async_io::segment_size(), d.size - o);
+                s->state = state;
+                segments.push_back(std::move(s));
+                ++state->pending;
+            }
+        }
+
+        if (state->pending == 0) {
+            // There is nothing to read, so we are done already.
+            try {
+                state->completion(nullptr);
+            } catch (...) { }
+        }
+    }
+
+    std::unique_lock<std::mutex> l(this->lock);
+    switch (this->type) {
+#if defined(DATRAW_WITH_IO_URING)
+        case backend_type::io_uring:
+            for (auto& s : segments) {
+                // Make sure that the completion queue cannot overflow.
+                if (this->inFlight >= this->maxInFlight) {
+                    this->flush_uring();
+                    this->condition.wait(l, [this](void) {
+                        return (this->inFlight < this->maxInFlight);
+                    });
+                }
+
+                this->queue_uring(s.release());
+                ++this->inFlight;
+            }
+            this->flush_uring();
+            break;
+#endif /* defined(DATRAW_WITH_IO_URING) */
+
+        default:
+            for (auto& s : segments) {
+                auto segment = s.get();
+                this->pool->submit([this, segment](void) {
+                    this->read_pool(segment);
+                });
+                s.release();
+                ++this->inFlight;
+            }
+            break;
+    }
+}
+
+
+/*
+ * DATRAW_DETAIL_NAMESPACE::async_io::complete
+ */
+void DATRAW_DETAIL_NAMESPACE::async_io::complete(
+        std::unique_ptr<segment_type>&& segment,
+        std::exception_ptr error) noexcept {
+    if (!error && segment->state->process) {
+        try {
+            segment->state->process(segment->dst, segment->size);
+        } catch (...) {
+            error = std::current_exception();
+        }
+    }
+
+    auto state = std::move(segment->state);
+    segment.reset();
+
+    if (error) {
+        std::lock_guard<std::mutex> l(state->lock);
+        if (!state->error) {
+            state->error = error;
+        }
+    }
+
+    if (--state->pending == 0) {
+        std::exception_ptr e;
+        {
+            std::lock_guard<std::mutex> l(state->lock);
+            e = state->error;
+        }
+
+        try {
+            state->completion(e);
+        } catch (...) {
+            // The completion must not throw, and there is no one we could
+            // report the error to anyway.
+        }
+    }
+}
+
+
+/*
+ * DATRAW_DETAIL_NAMESPACE::async_io::read_pool
+ */
+void DATRAW_DETAIL_NAMESPACE::async_io::read_pool(
+        segment_type *segment) noexcept {
+    std::unique_ptr<segment_type> s(segment);
+
+    std::exception_ptr error;
+    try {
+        s->state->source->read(s->offset, s->dst, s->size);
+    } catch (...) {
+        error = std::current_exception();
+    }
+
+    async_io::complete(std::move(s), error);
+
+    {
+        std::lock_guard<std::mutex> l(this->lock);
+        --this->inFlight;
+    }
+    this->condition.notify_all();
+}
+
+
+#if defined(DATRAW_WITH_IO_URING)
+/*
+ * DATRAW_DETAIL_NAMESPACE::async_io::close_uring
+ */
+void DATRAW_DETAIL_NAMESPACE::async_io::close_uring(void) noexcept {
+    if (this->sqes != nullptr) {
+        ::munmap(this->sqes, this->sqesSize);
+        this->sqes = nullptr;
+    }
+    if ((this->cqRing != nullptr) && (this->cqRing != this->sqRing)) {
+        ::munmap(this->cqRing, this->cqRingSize);
+    }
+    this->cqRing = nullptr;
+    if (this->sqRing != nullptr) {
+        ::munmap(this->sqRing, this->sqRingSize);
+        this->sqRing = nullptr;
+    }
+    if (this->ringFd >= 0) {
+        ::close(this->ringFd);
+        this->ringFd = -1;
+    }
+}
+
+
+/*
+ * DATRAW_DETAIL_NAMESPACE::async_io::flush_uring
+ */
+void DATRAW_DETAIL_NAMESPACE::async_io::flush_uring(void) {
+    for (;;) {
+        const auto head = __atomic_load_n(this->sqHead, __ATOMIC_ACQUIRE);
+        const auto cnt = *this->sqTail - head;
+        if (cnt == 0) {
+            return;
+        }
+
+        auto r = ::syscall(__NR_io_uring_enter, this->ringFd, cnt, 0, 0,
+            nullptr, 0);
+        if ((r < 0) && (errno != EINTR) && (errno != EAGAIN)) {
+            throw std::runtime_error("The asynchronous read could not be "
+                "submitted.");
+        }
+    }
+}
+
+
+/*
+ * DATRAW_DETAIL_NAMESPACE::async_io::open_uring
+ */
+bool DATRAW_DETAIL_NAMESPACE::async_io::open_uring(void) noexcept {
+    this->cqRing = nullptr;
+    this->sqRing = nullptr;
+    this->sqes = nullptr;
+
+    struct io_uring_params params;
+    std::memset(&params, 0, sizeof(params));
+    this->ringFd = static_cast<int>(::syscall(__NR_io_uring_setup, 128,
+        &params));
+    if (this->ringFd < 0) {
+        // The kernel does not support io_uring or we are not allowed to use
+        // it, eg because of seccomp filters in a container.
+        return false;
+    }
+
+    this->sqRingSize = params.sq_off.array
+        + params.sq_entries * sizeof(unsigned);
+    this->cqRingSize = params.cq_off.cqes
+        + params.cq_entries * sizeof(struct io_uring_cqe);
+    const auto singleMap = ((params.features & IORING_FEAT_SINGLE_MMAP) != 0);
+    if (singleMap) {
+        this->sqRingSize = this->cqRingSize = (std::max)(this->sqRingSize,
+            this->cqRingSize);
+    }
+
+    this->sqRing = ::mmap(nullptr, this->sqRingSize, PROT_READ | PROT_WRITE,
+        MAP_SHARED | MAP_POPULATE, this->ringFd, IORING_OFF_SQ_RING);
+    if (this->sqRing == MAP_FAILED) {
+        this->sqRing = nullptr;
+        this->close_uring();
+        return false;
+    }
+
+    if (singleMap) {
+        this->cqRing = this->sqRing;
+    } else {
+        this->cqRing = ::mmap(nullptr, this->cqRingSize,
+            PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, this->ringFd,
+            IORING_OFF_CQ_RING);
+        if (this->cqRing == MAP_FAILED) {
+            this->cqRing = nullptr;
+            this->close_uring();
+            return false;
+        }
+    }
+
+    this->sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+    auto sqes = ::mmap(nullptr, this->sqesSize, PROT_READ | PROT_WRITE,
+        MAP_SHARED | MAP_POPULATE, this->ringFd, IORING_OFF_SQES);
+    if (sqes == MAP_FAILED) {
+        this->close_uring();
+        return false;
+    }
+    this->sqes = static_cast<struct io_uring_sqe *>(sqes);
+
+    auto sq = static_cast<datraw::uint8 *>(this->sqRing);
+    this->sqHead = reinterpret_cast<unsigned *>(sq + params.sq_off.head);
+    this->sqTail = reinterpret_cast<unsigned *>(sq + params.sq_off.tail);
+    this->sqMask = *reinterpret_cast<unsigned *>(sq
+        + params.sq_off.ring_mask);
+    this->sqArray = reinterpret_cast<unsigned *>(sq + params.sq_off.array);
+    this->sqEntries = params.sq_entries;
+
+    auto cq = static_cast<datraw::uint8 *>(this->cqRing);
+    this->cqHead = reinterpret_cast<unsigned *>(cq + params.cq_off.head);
+    this->cqTail = reinterpret_cast<unsigned *>(cq + params.cq_off.tail);
+    this->cqMask = *reinterpret_cast<unsigned *>(cq
+        + params.cq_off.ring_mask);
+    this->cqes = reinterpret_cast<struct io_uring_cqe *>(cq
+        + params.cq_off.cqes);
+
+    // Never have more operations in flight than the completion queue can
+    // hold. The sentinel used for shutting down does not count, because we
+    // only send it once nothing is in flight.
+    this->maxInFlight = params.cq_entries;
+
+    return true;
+}
+
+
+/*
+ * DATRAW_DETAIL_NAMESPACE::async_io::queue_uring
+ */
+void DATRAW_DETAIL_NAMESPACE::async_io::queue_uring(segment_type *segment) {
+    auto tail = *this->sqTail;
+    if (tail - __atomic_load_n(this->sqHead, __ATOMIC_ACQUIRE)
+            >= this->sqEntries) {
+        // The submission queue is full, so hand it over to the kernel.
+        this->flush_uring();
+    }
+
+    const auto index = tail & this->sqMask;
+    auto sqe = this->sqes + index;
+    std::memset(sqe, 0, sizeof(*sqe));
+
+    if (segment != nullptr) {
+        segment->vec.iov_base = segment->dst + segment->done;
+        segment->vec.iov_len = segment->size - segment->done;
+
+        sqe->opcode = IORING_OP_READV;
+        sqe->fd = segment->state->source->native_handle();
+        sqe->addr = reinterpret_cast<std::uint64_t>(&segment->vec);
+        sqe->len = 1;
+        sqe->off = segment->offset + segment->done;
+    } else {
+        sqe->opcode = IORING_OP_NOP;
+    }
+    sqe->user_data = reinterpret_cast<std::uint64_t>(segment);
+
+    this->sqArray[index] = index;
+    __atomic_store_n(this->sqTail, tail + 1, __ATOMIC_RELEASE);
+}
+
+
+/*
+ * DATRAW_DETAIL_NAMESPACE::async_io::run_uring
+ */
+void DATRAW_DETAIL_NAMESPACE::async_io::run_uring(void) {
+    for (;;) {
+        ::syscall(__NR_io_uring_enter, this->ringFd, 0, 1,
+            IORING_ENTER_GETEVENTS, nullptr, 0);
+
+        auto head = *this->cqHead;
+        const auto tail = __atomic_load_n(this->cqTail, __ATOMIC_ACQUIRE);
+        auto exit = false;
+        size_type completed = 0;
+
+        if (head != tail) {
+            // The segments were handed over through the kernel, which the
+            // C++ memory model does not know about. Synchronise with the
+            // submitting threads, which hold the lock while queueing.
+            std::lock_guard<std::mutex> l(this->lock);
+        }
+
+        for (; head != tail; ++head) {
+            const auto& cqe = this->cqes[head & this->cqMask];
+            std::unique_ptr<segment_type> segment(
+                reinterpret_cast<segment_type *>(cqe.user_data));
+
+            if (segment == nullptr) {
+                // This is the sentinel sent from the destructor.
+                exit = true;
+                continue;
+            }
+
+            std::exception_ptr error;
+            if (cqe.res < 0) {
+                error = std::make_exception_ptr(std::runtime_error(
+                    "Reading from the raw file failed."));
+            } else if (cqe.res == 0) {
+                error = std::make_exception_ptr(std::runtime_error(
+                    "The raw file ended before all requested data could be "
+                    "read."));
+            } else if (static_cast<size_type>(cqe.res)
+                    < segment->size - segment->done) {
+                // This was a short read, so submit the rest again.
+                segment->done += cqe.res;
+
+                try {
+                    std::lock_guard<std::mutex> l(this->lock);
+                    this->queue_uring(segment.get());
+                    this->flush_uring();
+                    segment.release();
+                    continue;
+                } catch (...) {
+                    error = std::current_exception();
+                }
+            }
+
+            ++completed;
+
+            if (!error && segment->state->process) {
+                // Processing the data might be expensive, so it must not
+                // block the completions of the other reads in flight.
+                try {
+                    auto s = segment.get();
+                    thread_pool::instance().submit([s](void) {
+                        async_io::complete(std::unique_ptr<segment_type>(s),
+                            nullptr);
+                    });
+                    segment.release();
+                    continue;
+                } catch (...) {
+                    // If the pool cannot take the segment, we process it
+                    // here.
+                }
+            }
+
+            async_io::complete(std::move(segment), error);
+        }
+
+        __atomic_store_n(this->cqHead, head, __ATOMIC_RELEASE);
+
+        if (completed > 0) {
+            {
+                std::lock_guard<std::mutex> l(this->lock);
+                this->inFlight -= completed;
+            }
+            this->condition.notify_all();
+        }
+
+        if (exit) {
+            return;
+        }
+    }
+}
+#endif /* defined(DATRAW_WITH_IO_URING) */
@@ -0,0 +1,216 @@
+﻿// <copyright file="byte_swap.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2026 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_DATRAW_BYTE_SWAP_H)
+#define _DATRAW_BYTE_SWAP_H
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "datraw/cpu_features.h"
+
+
+DATRAW_DETAIL_NAMESPACE_BEGIN
+
+/// <summary>
+/// Answer the source index of byte <paramref name="i" /> in a shuffle that
+/// reverses the byte order of numbers with a width of
+/// <typeparamref name="W" /> bytes.
+/// </summary>
+template<std::size_t W>
+inline constexpr char byte_swap_index(const std::size_t i) noexcept {
+    return static_cast<char>((i / W) * W + (W - 1 - i % W));
+}
+
+
+#if defined(DATRAW_X86_KERNELS)
+/// <summary>
+/// Answer the <c>pshufb</c> mask reversing the byte order of numbers with a
+/// width of <typeparamref name="W" /> bytes in a 128-bit lane.
+/// </summary>
+template<std::size_t W> inline __m128i byte_swap_mask(void) noexcept {
+    return _mm_setr_epi8(byte_swap_index<W>(0), byte_swap_index<W>(1),
+        byte_swap_index<W>(2), byte_swap_index<W>(3),
+        byte_swap_index<W>(4), byte_swap_index<W>(5),
+        byte_swap_index<W>(6), byte_swap_index<W>(7),
+        byte_swap_index<W>(8), byte_swap_index<W>(9),
+        byte_swap_index<W>(10), byte_swap_index<W>(11),
+        byte_swap_index<W>(12), byte_swap_index<W>(13),
+        byte_swap_index<W>(14), byte_swap_index<W>(15));
+}
+
+
+/// <summary>
+/// Answer the <c>vpshufb</c> mask reversing the byte order of numbers with a
+/// width of <typeparamref name="W" /> bytes in all four 128-bit lanes.
+/// </summary>
+/// <remarks>
+/// The mask is loaded from a constant table, because broadcasting the 128-bit
+/// mask causes spurious warnings about uninitialised variables in the
+/// AVX-512 headers of GCC.
+/// </remarks>
+template<std::size_t W, std::size_t... I>
+DATRAW_TARGET("avx512f") inline __m512i byte_swap_mask512(
+        std::index_sequence<I...>) noexcept {
+    alignas(64) static const char mask[] = { byte_swap_index<W>(I)... };
+    return _mm512_load_si512(mask);
+}
+
+
+/// <summary>
+/// Reverses the byte order of the numbers in all complete 16-byte blocks of
+/// <paramref name="src" /> using SSSE3 and writes them to
+/// <paramref name="dst" />.
+/// </summary>
+/// <returns>The number of elements that have been processed.</returns>
+template<std::size_t W>
+DATRAW_TARGET("ssse3") std::size_t byte_swap_ssse3(const void *src,
+        void *dst, const std::size_t cnt) noexcept {
+    auto s = static_cast<const std::uint8_t *>(src);
+    auto d = static_cast<std::uint8_t *>(dst);
+    const auto mask = byte_swap_mask<W>();
+    const auto size = (cnt * W) & ~std::size_t(15);
+
+    for (std::size_t i = 0; i < size; i += 16) {
+        const auto v = _mm_loadu_si128(
+            reinterpret_cast<const __m128i *>(s + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(d + i),
+            _mm_shuffle_epi8(v, mask));
+    }
+
+    return size / W;
+}
+
+
+/// <summary>
+/// Reverses the byte order of the numbers in all complete 32-byte blocks of
+/// <paramref name="src" /> using AVX2 and writes them to
+/// <paramref name="dst" />.
+/// </summary>
+/// <returns>The number of elements that have been processed.</returns>
+template<std::size_t W>
+DATRAW_TARGET("avx2") std::size_t byte_swap_avx2(const void *src,
+        void *dst, const std::size_t cnt) noexcept {
+    auto s = static_cast<const std::uint8_t *>(src);
+    auto d = static_cast<std::uint8_t *>(dst);
+    const auto mask = _mm256_broadcastsi128_si256(byte_swap_mask<W>());
+    const auto size = (cnt * W) & ~std::size_t(31);
+
+    for (std::size_t i = 0; i < size; i += 32) {
+        const auto v = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i *>(s + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(d + i),
+            _mm256_shuffle_epi8(v, mask));
+    }
+
+    return size / W;
+}
+
+
+/// <summary>
+/// Reverses the byte order of the numbers in all complete 64-byte blocks of
+/// <paramref name="src" /> using AVX-512 and writes them to
+/// <paramref name="dst" />.
+/// </summary>
+/// <returns>The number of elements that have been processed.</returns>
+template<std::size_t W>
+DATRAW_TARGET("avx512f,avx512bw") std::size_t byte_swap_avx512(
+        const void *src, void *dst, const std::size_t cnt) noexcept {
+    auto s = static_cast<const std::uint8_t *>(src);
+    auto d = static_cast<std::uint8_t *>(dst);
+    const auto mask = byte_swap_mask512<W>(std::make_index_sequence<64>());
+    const auto size = (cnt * W) & ~std::size_t(63);
+
+    for (std::size_t i = 0; i < size; i += 64) {
+        _mm512_storeu_si512(d + i, _mm512_shuffle_epi8(
+            _mm512_loadu_si512(s + i), mask));
+    }
+
+    return size / W;
+}
+#endif /* defined(DATRAW_X86_KERNELS) */
+
+
+#if defined(DATRAW_NEON_KERNELS)
+/// <summary>
+/// Reverses the byte order within each <typeparamref name="W" />-byte
+/// number of a NEON register.
+/// </summary>
+template<std::size_t W> uint8x16_t byte_swap_neon_reverse(uint8x16_t v);
+
+template<> inline uint8x16_t byte_swap_neon_reverse<2>(uint8x16_t v) {
+    return vrev16q_u8(v);
+}
+
+template<> inline uint8x16_t byte_swap_neon_reverse<4>(uint8x16_t v) {
+    return vrev32q_u8(v);
+}
+
+template<> inline uint8x16_t byte_swap_neon_reverse<8>(uint8x16_t v) {
+    return vrev64q_u8(v);
+}
+
+
+/// <summary>
+/// Reverses the byte order of the numbers in all complete 16-byte blocks of
+/// <paramref name="src" /> using NEON and writes them to
+/// <paramref name="dst" />.
+/// </summary>
+/// <returns>The number of elements that have been processed.</returns>
+template<std::size_t W>
+std::size_t byte_swap_neon(const void *src, void *dst,
+        const std::size_t cnt) noexcept {
+    auto s = static_cast<const std::uint8_t *>(src);
+    auto d = static_cast<std::uint8_t *>(dst);
+    const auto size = (cnt * W) & ~std::size_t(15);
+
+    for (std::size_t i = 0; i < size; i += 16) {
+        vst1q_u8(d + i, byte_swap_neon_reverse<W>(vld1q_u8(s + i)));
+    }
+
+    return size / W;
+}
+#endif /* defined(DATRAW_NEON_KERNELS) */
+
+
+/// <summary>
+/// Reverses the byte order of as many of the <paramref name="cnt" /> numbers
+/// with a width of <typeparamref name="W" /> bytes in <paramref name="src" />
+/// as possible using the best vector instructions the CPU supports and
+/// writes them to <paramref name="dst" />.
+/// </summary>
+/// <remarks>
+/// <para>The caller is responsible for processing the remaining elements,
+/// which are less than the width of a vector register.</para>
+/// <para><paramref name="src" /> and <paramref name="dst" /> must either be
+/// the same or not overlap at all.</para>
+/// </remarks>
+/// <returns>The number of elements that have been processed.</returns>
+template<std::size_t W>
+inline std::size_t byte_swap_vectorised(const void *src, void *dst,
+        const std::size_t cnt) {
+    static_assert((W == 2) || (W == 4) || (W == 8), "Byte swapping is only "
+        "supported for numbers with a width of 2, 4 or 8 bytes.");
+#if defined(DATRAW_X86_KERNELS)
+    const auto& cpu = cpu_features::instance();
+    if (cpu.avx512bw) {
+        return byte_swap_avx512<W>(src, dst, cnt);
+    } else if (cpu.avx2) {
+        return byte_swap_avx2<W>(src, dst, cnt);
+    } else if (cpu.ssse3) {
+        return byte_swap_ssse3<W>(src, dst, cnt);
+    }
+#elif defined(DATRAW_NEON_KERNELS)
+    return byte_swap_neon<W>(src, dst, cnt);
+#endif /* defined(DATRAW_X86_KERNELS) */
+    return 0;
+}
+
+DATRAW_DETAIL_NAMESPACE_END
+
+#endif /* !defined(_DATRAW_BYTE_SWAP_H) */
@@ -1,5 +1,5 @@
 ﻿// <copyright file="convert.h" company="Visualisierungsinstitut der Universität Stuttgart">
-// Copyright © 2017 - 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Copyright © 2017 - 2026 Visualisierungsinstitut der Universität Stuttgart.
 // Licensed under the MIT licence. See LICENCE file for details.
 // </copyright>
 // <author>Christoph Müller</author>
@@ -9,11 +9,23 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <cinttypes>
+#include <cmath>
 #include <cstddef>
+#include <cstring>
+#include <iterator>
 #include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 
+#include "datraw/byte_swap.h"
+#include "datraw/convert_kernels.h"
+#include "datraw/parallel.h"
+#include "datraw/scalar_type.h"
 #include "datraw/types.h"
 
 
@@ -31,10 +43,21 @@ DATRAW_NAMESPACE_BEGIN
 /// cast is performed, assuming that the data are within [0, 1].</para>
 /// <para>For all floating point types, it is assumed that valid values are
 /// within [0, 1]. Conversion to integral types is performed by scaling the
-/// values to the range of the type.</para>
+/// values to the range of the type. <c>float16</c> is a floating point type
+/// in this sense; it is converted via single precision.</para>
 /// <para>Conversions from integral to other integral types are performed by
 /// rescaling to the range of <typeparamref name="T" /> via double precision
 /// floating point arithmetics.</para>
+/// <para>If both iterators are pointers or iterators of contiguous standard
+/// containers, the conversions from
+/// <c>uint8</c>, <c>uint16</c> and <c>int16</c> to <c>float</c>, from
+/// <c>float</c> to <c>uint8</c> and <c>uint16</c> and from <c>uint16</c> to
+/// <c>uint8</c> as well as between <c>float16</c> and <c>float</c>,
+/// <c>uint8</c> and <c>uint16</c> are vectorised if the CPU supports it.
+/// The vectorised conversions yield the same results as the scalar ones.</para>
+/// <para>Large ranges of 8-bit and 16-bit integers are converted using a
+/// <see cref="lookup_table" /> holding the result for all possible input
+/// values, which is computed once per combination of types.</para>
 /// </remarks>
 /// <tparam name="T">The target type.</tparam>
 /// <tparam name="I">The type of the input iterator.</tparam>
@@ -62,13 +85,262 @@ template<class T, class I, class O> void convert(I begin, I end, O dst);
 /// <param name="dst">The beginning of the destination range, which must be
 /// able to hold the same number of elements as the source range.</param>
 template<class I, class O> void convert(I begin, I end, O dst) {
-    convert<typename O::value_type>(begin, end, dst);
+    convert<typename std::iterator_traits<O>::value_type>(begin, end, dst);
 }
 
+/// <summary>
+/// Convert the range of items designated by <paramref name="begin" /> and
+/// <paramref name="end" /> to type <tparamref name="T" /> and write the
+/// result to <paramref name="dst" /> using multiple threads.
+/// </summary>
+/// <remarks>
+/// <para>The range is split into chunks of a few hundred kilobytes, which
+/// are distributed dynamically between the threads. The conversion rules are
+/// the same as for the single-threaded version of the method.</para>
+/// </remarks>
+/// <tparam name="T">The target type.</tparam>
+/// <tparam name="I">The type of the input iterator, which must be a random
+/// access iterator.</tparam>
+/// <tparam name="O">The type of the output iterator, which must be a random
+/// access iterator.</tparam>
+/// <param name="begin">The begin of the range to be converted.</param>
+/// <param name="end">The end of the range to be converted.</param>
+/// <param name="dst">The beginning of the destination range, which must be
+/// able to hold the same number of elements as the source range.</param>
+/// <param name="concurrency">The maximum number of threads, where zero means
+/// that the number of hardware threads should be used.</param>
+template<class T, class I, class O>
+void convert(I begin, I end, O dst, const std::size_t concurrency);
+
+/// <summary>
+/// Convert the range of items designated by <paramref name="begin" /> and
+/// <paramref name="end" /> to the value type of <tparamref name="O" /> and
+/// write the result to <paramref name="dst" /> using multiple threads.
+/// </summary>
+/// <tparam name="I">The type of the input iterator, which must be a random
+/// access iterator.</tparam>
+/// <tparam name="O">The type of the output iterator, which must be a random
+/// access iterator.</tparam>
+/// <param name="begin">The begin of the range to be converted.</param>
+/// <param name="end">The end of the range to be converted.</param>
+/// <param name="dst">The beginning of the destination range, which must be
+/// able to hold the same number of elements as the source range.</param>
+/// <param name="concurrency">The maximum number of threads, where zero means
+/// that the number of hardware threads should be used.</param>
+template<class I, class O>
+void convert(I begin, I end, O dst, const std::size_t concurrency) {
+    convert<typename std::iterator_traits<O>::value_type>(begin, end, dst,
+        concurrency);
+}
+
+/// <summary>
+/// Convert <paramref name="cnt" /> scalars of the run-time type
+/// <paramref name="srcType" /> at <paramref name="src" /> to
+/// <paramref name="dstType" /> and write the result to
+/// <paramref name="dst" />.
+/// </summary>
+/// <remarks>
+/// <para>The conversion rules are the same as for the typed version of the
+/// method. The instantiation for the pair of types is selected from a table
+/// that is generated at compile time for all supported scalar types, ie the
+/// data are processed by the same code, including the vectorised kernels
+/// and lookup tables, as if the types were known at compile time.</para>
+/// <para>This allows for converting type-erased frames, eg from
+/// <see cref="raw_reader::read_current" />, without a switch over all
+/// combinations of types.</para>
+/// </remarks>
+/// <param name="srcType">The scalar type of the source data.</param>
+/// <param name="src">A pointer to <paramref name="cnt" /> scalars of type
+/// <paramref name="srcType" />.</param>
+/// <param name="dstType">The scalar type of the destination.</param>
+/// <param name="dst">A pointer to the destination, which must be able to
+/// hold <paramref name="cnt" /> scalars of type <paramref name="dstType" />
+/// and must not overlap with <paramref name="src" />.</param>
+/// <param name="cnt">The number of scalars to convert.</param>
+/// <exception cref="std::invalid_argument">If any of the scalar types is
+/// <see cref="scalar_type::raw" /> or otherwise not supported.</exception>
+inline void convert(const scalar_type srcType, const void *src,
+    const scalar_type dstType, void *dst, const std::size_t cnt);
+
+/// <summary>
+/// Convert the range of items designated by <paramref name="begin" /> and
+/// <paramref name="end" /> to type <tparamref name="T" /> after mapping the
+/// window [<paramref name="min" />, <paramref name="max" />] of the input
+/// values to [0, 1].
+/// </summary>
+/// <remarks>
+/// <para>In contrast to <see cref="convert" />, which assumes floating point
+/// data to be within [0, 1] and integral data to use the whole range of
+/// their type, the window selects the part of the data range that is
+/// relevant, eg the window/level of CT data. Values outside the window are
+/// clamped. The result in [0, 1] is scaled to the range of
+/// <typeparamref name="T" /> if it is an integral type.</para>
+/// <para>The computation is performed in single precision if the input and
+/// the output are floating point types or integral types with at most 16
+/// bits and in double precision otherwise. If both iterators are pointers,
+/// the conversions from <c>uint8</c>, <c>uint16</c>, <c>int16</c> and
+/// <c>float</c> to <c>float</c>, <c>uint8</c> and <c>uint16</c> are
+/// vectorised if the CPU supports it. The vectorised conversions yield the
+/// same results as the scalar ones.</para>
+/// </remarks>
+/// <tparam name="T">The target type.</tparam>
+/// <tparam name="I">The type of the input iterator.</tparam>
+/// <tparam name="O">The type of the output iterator.</tparam>
+/// <param name="begin">The begin of the range to be converted.</param>
+/// <param name="end">The end of the range to be converted.</param>
+/// <param name="dst">The beginning of the destination range, which must be
+/// able to hold the same number of elements as the source range.</param>
+/// <param name="min">The input value that is mapped to zero.</param>
+/// <param name="max">The input value that is mapped to one. If this is the
+/// same as <paramref name="min" />, all values are mapped to zero.</param>
+/// <exception cref="std::invalid_argument">If <paramref name="max" /> is
+/// less than <paramref name="min" />.</exception>
+template<class T, class I, class O>
+void convert_window(I begin, I end, O dst, const double min,
+    const double max);
+
+/// <summary>
+/// Convert the range of items designated by <paramref name="begin" /> and
+/// <paramref name="end" /> to type <tparamref name="T" /> after mapping the
+/// range of the input values to [0, 1].
+/// </summary>
+/// <remarks>
+/// The range is determined by <see cref="find_range" /> and then used as
+/// window for <see cref="convert_window" />, ie the data are read twice, but
+/// only written once. Both passes are vectorised for the types supported by
+/// the vectorised kernels of the two methods.
+/// </remarks>
+/// <tparam name="T">The target type.</tparam>
+/// <tparam name="I">The type of the input iterator, which must be a forward
+/// iterator.</tparam>
+/// <tparam name="O">The type of the output iterator.</tparam>
+/// <param name="begin">The begin of the range to be converted.</param>
+/// <param name="end">The end of the range to be converted.</param>
+/// <param name="dst">The beginning of the destination range, which must be
+/// able to hold the same number of elements as the source range.</param>
+/// <returns>The minimum and the maximum of the input, which have been mapped
+/// to zero and one.</returns>
+template<class T, class I, class O>
+std::pair<typename std::iterator_traits<I>::value_type,
+    typename std::iterator_traits<I>::value_type>
+convert_auto_range(I begin, I end, O dst);
+
+/// <summary>
+/// Determines the minimum and the maximum of the range designated by
+/// <paramref name="begin" /> and <paramref name="end" />.
+/// </summary>
+/// <remarks>
+/// If the iterator is a pointer to <c>uint8</c>, <c>uint16</c>,
+/// <c>int16</c> or <c>float</c>, the bulk of the data is reduced using
+/// vector instructions if the CPU supports it. The result for floating
+/// point data containing NaNs is undefined.
+/// </remarks>
+/// <tparam name="I">The type of the input iterator.</tparam>
+/// <param name="begin">The begin of the range to be searched.</param>
+/// <param name="end">The end of the range to be searched.</param>
+/// <returns>The minimum and the maximum of the range or a pair of
+/// value-initialised elements if the range is empty.</returns>
+template<class I>
+std::pair<typename std::iterator_traits<I>::value_type,
+    typename std::iterator_traits<I>::value_type>
+find_range(I begin, I end);
+
+/// <summary>
+/// Copy <paramref name="cnt" /> numbers with a width of 8 bytes each from
+/// <paramref name="src" /> to <paramref name="dst" /> and convert their byte
+/// order on the way.
+/// </summary>
+/// <remarks>
+/// The bulk of the data is processed using the widest vector instructions
+/// available on the CPU, which are detected at runtime.
+/// </remarks>
+/// <param name="src">A pointer to the data to be converted.</param>
+/// <param name="dst">A pointer to the destination, which must either be the
+/// same as <paramref name="src" /> or not overlap with it.</param>
+/// <param name="cnt">The number of numbers designated by
+/// <paramref name="src" />.</param>
+inline void copy_swap_byte_order(const uint64 *src, uint64 *dst,
+    const std::size_t cnt);
+
+/// <summary>
+/// Copy <paramref name="cnt" /> numbers with a width of 4 bytes each from
+/// <paramref name="src" /> to <paramref name="dst" /> and convert their byte
+/// order on the way.
+/// </summary>
+/// <remarks>
+/// The bulk of the data is processed using the widest vector instructions
+/// available on the CPU, which are detected at runtime.
+/// </remarks>
+/// <param name="src">A pointer to the data to be converted.</param>
+/// <param name="dst">A pointer to the destination, which must either be the
+/// same as <paramref name="src" /> or not overlap with it.</param>
+/// <param name="cnt">The number of numbers designated by
+/// <paramref name="src" />.</param>
+inline void copy_swap_byte_order(const uint32 *src, uint32 *dst,
+    const std::size_t cnt);
+
+/// <summary>
+/// Copy <paramref name="cnt" /> numbers with a width of 2 bytes each from
+/// <paramref name="src" /> to <paramref name="dst" /> and convert their byte
+/// order on the way.
+/// </summary>
+/// <remarks>
+/// The bulk of the data is processed using the widest vector instructions
+/// available on the CPU, which are detected at runtime.
+/// </remarks>
+/// <param name="src">A pointer to the data to be converted.</param>
+/// <param name="dst">A pointer to the destination, which must either be the
+/// same as <paramref name="src" /> or not overlap with it.</param>
+/// <param name="cnt">The number of numbers designated by
+/// <paramref name="src" />.</param>
+inline void copy_swap_byte_order(const uint16 *src, uint16 *dst,
+    const std::size_t cnt);
+
+/// <summary>
+/// Copy <paramref name="cnt" /> numbers with a <paramref name="width" />
+/// bytes each from <paramref name="src" /> to <paramref name="dst" /> and
+/// convert their byte order on the way.
+/// </summary>
+/// <remarks>
+/// This is the out-of-place variant of <see cref="swap_byte_order" />, which
+/// allows for converting data from read-only memory like a mapped file
+/// without copying them first.
+/// </remarks>
+/// <param name="width">The width of a number in bytes. If this is not 2, 4
+/// or 8, the data are copied without any conversion.</param>
+/// <param name="src">A pointer to the data to be converted.</param>
+/// <param name="dst">A pointer to the destination, which must either be the
+/// same as <paramref name="src" /> or not overlap with it.</param>
+/// <param name="cnt">The number of numbers designated by
+/// <paramref name="src" />.</param>
+inline void copy_swap_byte_order(const std::size_t width, const void *src,
+    void *dst, const std::size_t cnt);
+
+/// <summary>
+/// Copy <paramref name="cnt" /> numbers with a <paramref name="width" />
+/// bytes each from <paramref name="src" /> to <paramref name="dst" /> and
+/// convert their byte order on the way using multiple threads.
+/// </summary>
+/// <param name="width">The width of a number in bytes. If this is not 2, 4
+/// or 8, the data are copied without any conversion.</param>
+/// <param name="src">A pointer to the data to be converted.</param>
+/// <param name="dst">A pointer to the destination, which must either be the
+/// same as <paramref name="src" /> or not overlap with it.</param>
+/// <param name="cnt">The number of numbers designated by
+/// <paramref name="src" />.</param>
+/// <param name="concurrency">The maximum number of threads, where zero means
+/// that the number of hardware threads should be used.</param>
+inline void copy_swap_byte_order(const std::size_t width, const void *src,
+    void *dst, const std::size_t cnt, const std::size_t concurrency);
+
 /// <summary>
 /// Convert the byte order of <paramref name="cnt" /> numbers with a width
 /// of 8 bytes each.
 /// </summary>
+/// <remarks>
+/// The bulk of the data is processed using the widest vector instructions
+/// available on the CPU, which are detected at runtime.
+/// </remarks>
 /// <param name="data">A pointer to the data to be converted.</param>
 /// <param name="cnt">The number of numbers designated by
 /// <paramref name="data" />.</param>
@@ -78,6 +350,10 @@ inline void swap_byte_order(uint64 *data, const std::size_t cnt);
 /// Convert the byte order of <paramref name="cnt" /> numbers with a width
 /// of 4 bytes each.
 /// </summary>
+/// <remarks>
+/// The bulk of the data is processed using the widest vector instructions
+/// available on the CPU, which are detected at runtime.
+/// </remarks>
 /// <param name="data">A pointer to the data to be converted.</param>
 /// <param name="cnt">The number of numbers designated by
 /// <paramref name="data" />.</param>
@@ -87,6 +363,10 @@ inline void swap_byte_order(uint32 *data, const std::size_t cnt);
 /// Convert the byte order of <paramref name="cnt" /> numbers with a width
 /// of 2 bytes each.
 /// </summary>
+/// <remarks>
+/// The bulk of the data is processed using the widest vector instructions
+/// available on the CPU, which are detected at runtime.
+/// </remarks>
 /// <param name="data">A pointer to the data to be converted.</param>
 /// <param name="cnt">The number of numbers designated by
 /// <paramref name="data" />.</param>
@@ -104,8 +384,119 @@ inline void swap_byte_order(uint16 *data, const std::size_t cnt);
 inline void swap_byte_order(const std::size_t width, void *data,
     const std::size_t cnt);
 
+/// <summary>
+/// Convert the byte order of <paramref name="cnt" /> numbers with a
+/// <paramref name="width" /> bytes each using multiple threads.
+/// </summary>
+/// <remarks>
+/// The data are split into chunks of a few hundred kilobytes, which are
+/// distributed dynamically between the threads.
+/// </remarks>
+/// <param name="width">The width of a number in bytes, which must be
+/// 2, 4 or 8 in order for the implementation to do anything.</param>
+/// <param name="data">A pointer to the data to be converted.</param>
+/// <param name="cnt">The number of numbers designated by
+/// <paramref name="data" />.</param>
+/// <param name="concurrency">The maximum number of threads, where zero means
+/// that the number of hardware threads should be used.</param>
+inline void swap_byte_order(const std::size_t width, void *data,
+    const std::size_t cnt, const std::size_t concurrency);
+
 DATRAW_NAMESPACE_END
 
+
+DATRAW_DETAIL_NAMESPACE_BEGIN
+
+/// <summary>
+/// Determines whether <typeparamref name="T" /> is treated as a floating
+/// point type by <see cref="convert" />, which in contrast to
+/// <c>std::is_floating_point</c> includes <see cref="float16" />.
+/// </summary>
+template<class T> struct is_floating_point
+    : std::integral_constant<bool, std::is_floating_point<T>::value
+        || std::is_same<T, float16>::value> { };
+
+/// <summary>
+/// The type in which <see cref="convert" /> computes with values of type
+/// <typeparamref name="T" />, which is <c>float</c> for <c>float16</c>
+/// because it does not support arithmetics.
+/// </summary>
+template<class T> using arithmetic_t = typename std::conditional<
+    std::is_same<T, float16>::value, float, T>::type;
+
+/// <summary>
+/// The type in which <see cref="convert_window" /> computes the conversion
+/// from <typeparamref name="S" /> to <typeparamref name="T" />, which is
+/// <c>float</c> if neither of the types has more than 16 significant bits
+/// and <c>double</c> otherwise.
+/// </summary>
+template<class S, class T> using window_arithmetic_t
+    = typename std::conditional<
+        (std::is_same<S, float>::value || (sizeof(S) <= 2))
+        && (std::is_same<T, float>::value || (sizeof(T) <= 2)),
+        float, double>::type;
+
+/// <summary>
+/// The signature of a conversion between two scalar types behind
+/// type-erased pointers.
+/// </summary>
+typedef void (*convert_function)(const void *, void *, const std::size_t);
+
+/// <summary>
+/// Converts <paramref name="cnt" /> scalars of type
+/// <typeparamref name="S" /> to <typeparamref name="T" />.
+/// </summary>
+template<scalar_type S, scalar_type T>
+void convert_erased(const void *src, void *dst, const std::size_t cnt);
+
+/// <summary>
+/// Answer the conversions from <typeparamref name="S" /> to all types in
+/// the given list.
+/// </summary>
+template<scalar_type S, scalar_type... Ts>
+inline constexpr std::array<convert_function, sizeof...(Ts)> convert_row(
+        scalar_type_list_t<Ts...>) noexcept {
+    return {{ &convert_erased<S, Ts>... }};
+}
+
+/// <summary>
+/// Looks up the conversion from <paramref name="src" /> to
+/// <paramref name="dst" /> in a table of the instantiations for all pairs
+/// of types in the given list.
+/// </summary>
+/// <returns>The conversion function or <c>nullptr</c> if any of the types
+/// is not in the list.</returns>
+template<scalar_type... Ts>
+convert_function get_convert_function(scalar_type_list_t<Ts...>,
+    const scalar_type src, const scalar_type dst) noexcept;
+
+/// <summary>
+/// Implements the conversion rules of <see cref="convert" /> element by
+/// element.
+/// </summary>
+template<class T, class I, class O> void convert_scalar(I begin, I end,
+    O dst);
+
+/// <summary>
+/// Indicates that the range cannot be converted using a table of all
+/// possible input values.
+/// </summary>
+/// <returns><c>false</c>.</returns>
+template<class T, class I, class O>
+bool convert_lookup(I begin, I end, O dst, std::false_type);
+
+/// <summary>
+/// Converts the range using a table of all possible input values if this
+/// is possible and worthwhile.
+/// </summary>
+/// <returns><c>true</c> if the range has been converted, <c>false</c> if
+/// the caller must convert it.</returns>
+template<class T, class I, class O>
+bool convert_lookup(I begin, I end, O dst, std::true_type);
+
+DATRAW_DETAIL_NAMESPACE_END
+
 #include "datraw/convert.inl"
+#include "datraw/lookup_table.h"
 
 #endif /* !defined(_DATRAW_CONVERT_H) */
@@ -1,5 +1,5 @@
 ﻿// <copyright file="convert.inl" company="Visualisierungsinstitut der Universität Stuttgart">
-// Copyright © 2017 - 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Copyright © 2017 - 2026 Visualisierungsinstitut der Universität Stuttgart.
 // Licensed under the MIT licence. See LICENCE file for details.
 // </copyright>
 // <author>Christoph Müller</author>
@@ -10,7 +10,33 @@
  */
 template<class T, class I, class O>
 void DATRAW_NAMESPACE::convert(I begin, I end , O dst) {
-    typedef typename I::value_type S;
+    typedef typename std::iterator_traits<I>::value_type S;
+    typedef std::integral_constant<bool, std::is_integral<S>::value
+        && (sizeof(S) <= 2)
+        && !std::is_same<S, T>::value
+        && !std::is_same<S, bool>::value
+        && std::is_base_of<std::random_access_iterator_tag,
+            typename std::iterator_traits<I>::iterator_category>::value>
+        lookup_tag;
+
+    // If there is a vectorised kernel for the combination of types, process
+    // the bulk of the data with it and leave the tail to the code below.
+    detail::convert_vectorised<T>(begin, end, dst);
+
+    // Large ranges of 8-bit and 16-bit integers are converted using a table
+    // of all possible values, which is computed once.
+    if (!detail::convert_lookup<T>(begin, end, dst, lookup_tag())) {
+        detail::convert_scalar<T>(begin, end, dst);
+    }
+}
+
+
+/*
+ * DATRAW_DETAIL_NAMESPACE::convert_scalar
+ */
+template<class T, class I, class O>
+void DATRAW_DETAIL_NAMESPACE::convert_scalar(I begin, I end, O dst) {
+    typedef typename std::iterator_traits<I>::value_type S;
 
     if DATRAW_CONSTEXPR_IF (std::is_same<S, T>::value) {
         // This is an identity transform.
@@ -21,49 +47,59 @@ void DATRAW_NAMESPACE::convert(I begin, I end , O dst) {
         std::copy(begin, end, dst);
 #pragma warning(pop)
 
-    } else if DATRAW_CONSTEXPR_IF (std::is_floating_point<S>::value
-            && std::is_floating_point<T>::value) {
+    } else if DATRAW_CONSTEXPR_IF (detail::is_floating_point<S>::value
+            && detail::is_floating_point<T>::value) {
         // Floating point conversion happens by simple cast, because we assume
-        // floating point data sets to have values within [0, 1].
-        std::transform(begin, end, dst,
-            [](const S s) { return static_cast<T>(s); });
+        // floating point data sets to have values within [0, 1]. Half
+        // precision is cast via single precision.
+        std::transform(begin, end, dst, [](const S s) {
+            return static_cast<T>(static_cast<arithmetic_t<S>>(s));
+        });
 
-    } else if DATRAW_CONSTEXPR_IF (std::is_floating_point<T>::value) {
+    } else if DATRAW_CONSTEXPR_IF (detail::is_floating_point<T>::value) {
         // Conversion from integral to [0, 1] floating point range.
-        assert(!std::is_floating_point<S>::value);
+        assert(!detail::is_floating_point<S>::value);
+        typedef arithmetic_t<T> arithmetic_type;
         auto tmin = std::numeric_limits<S>::lowest();
         auto tmax = (std::numeric_limits<S>::max)();
-        auto trange = static_cast<T>(tmax - tmin);
+        auto trange = static_cast<arithmetic_type>(tmax - tmin);
 
         while (begin != end) {
-            auto value = static_cast<T>(*begin++);
+            auto value = static_cast<arithmetic_type>(*begin++);
             value /= trange;
-            *dst++ = value;
+            *dst++ = static_cast<T>(value);
         }
 
-    } else if DATRAW_CONSTEXPR_IF (std::is_floating_point<S>::value) {
+    } else if DATRAW_CONSTEXPR_IF (detail::is_floating_point<S>::value) {
         // Conversion from [0, 1] to integral type.
-        assert(!std::is_floating_point<T>::value);
-        constexpr auto tmin = static_cast<S>(std::numeric_limits<T>::lowest());
-        constexpr auto tmax = static_cast<S>((std::numeric_limits<T>::max)());
-        auto trange = static_cast<S>(tmax - tmin);
+        assert(!detail::is_floating_point<T>::value);
+        typedef arithmetic_t<S> arithmetic_type;
+        // Note: these cannot be constexpr, because the branch is compiled for
+        // all combinations of types unless we have a constexpr if.
+        const auto tmin = static_cast<arithmetic_type>(
+            std::numeric_limits<T>::lowest());
+        const auto tmax = static_cast<arithmetic_type>(
+            (std::numeric_limits<T>::max)());
+        auto trange = static_cast<arithmetic_type>(tmax - tmin);
 
         while (begin != end) {
-            auto value = *begin++;
+            auto value = static_cast<arithmetic_type>(*begin++);
             value *= trange;
             value += tmin;
             *dst++ = static_cast<T>(value);
         }
 
     } else {
-        // All other conversions require both data type ranges.
-        constexpr auto smin = static_cast<double>(
+        // All other conversions require both data type ranges. As above,
+        // these cannot be constexpr, because the branch is also compiled for
+        // float16, whose conversion to float is not constexpr.
+        const auto smin = static_cast<double>(
             std::numeric_limits<S>::lowest());
-        constexpr auto smax = static_cast<double>(
+        const auto smax = static_cast<double>(
             (std::numeric_limits<S>::max)());
-        constexpr auto tmin = static_cast<double>(
+        const auto tmin = static_cast<double>(
             std::numeric_limits<T>::lowest());
-        constexpr auto tmax = static_cast<double>(
+        const auto tmax = static_cast<double>(
             (std::numeric_limits<T>::max)());
         auto srange = smax - smin;
         auto trange = tmax - tmin;
@@ -80,12 +116,202 @@ void DATRAW_NAMESPACE::convert(I begin, I end , O dst) {
 
 
 /*
- * DATRAW_NAMESPACE::swap_byte_order
+ * DATRAW_NAMESPACE::convert
  */
-void DATRAW_NAMESPACE::swap_byte_order(uint64 *data, const std::size_t cnt) {
-    assert((data != nullptr) || (cnt == 0));
-    for (size_t i = 0; i < cnt; i++) {
-        auto v = data[i];
+template<class T, class I, class O>
+void DATRAW_NAMESPACE::convert(I begin, I end, O dst,
+        const std::size_t concurrency) {
+    typedef typename std::iterator_traits<I>::value_type S;
+    static_assert(std::is_base_of<std::random_access_iterator_tag,
+        typename std::iterator_traits<I>::iterator_category>::value,
+        "The input must be a random access iterator.");
+    static_assert(std::is_base_of<std::random_access_iterator_tag,
+        typename std::iterator_traits<O>::iterator_category>::value,
+        "The output must be a random access iterator.");
+
+    const auto cnt = static_cast<std::size_t>(std::distance(begin, end));
+    const auto chunk = detail::parallel_chunk_size()
+        / (std::max)(sizeof(S), sizeof(T));
+    detail::parallel_chunks(cnt, chunk, concurrency,
+            [&](const std::size_t b, const std::size_t e) {
+        convert<T>(begin + b, begin + e, dst + b);
+    });
+}
+
+
+/*
+ * DATRAW_NAMESPACE::convert
+ */
+void DATRAW_NAMESPACE::convert(const scalar_type srcType, const void *src,
+        const scalar_type dstType, void *dst, const std::size_t cnt) {
+    const auto func = detail::get_convert_function(detail::scalar_type_list(),
+        srcType, dstType);
+
+    if (func == nullptr) {
+        std::stringstream msg;
+        msg << "Data of scalar type " << static_cast<int>(srcType)
+            << " cannot be converted to scalar type "
+            << static_cast<int>(dstType) << "." << std::ends;
+        throw std::invalid_argument(msg.str());
+    }
+
+    assert((src != nullptr) || (cnt == 0));
+    assert((dst != nullptr) || (cnt == 0));
+    func(src, dst, cnt);
+}
+
+
+/*
+ * DATRAW_DETAIL_NAMESPACE::convert_erased
+ */
+template<DATRAW_NAMESPACE::scalar_type S, DATRAW_NAMESPACE::scalar_type T>
+void DATRAW_DETAIL_NAMESPACE::convert_erased(const void *src, void *dst,
+        const std::size_t cnt) {
+    auto s = static_cast<const scalar_t<S> *>(src);
+    auto d = static_cast<scalar_t<T> *>(dst);
+    DATRAW_NAMESPACE::convert<scalar_t<T>>(s, s + cnt, d);
+}
+
+
+/*
+ * DATRAW_DETAIL_NAMESPACE::get_convert_function
+ */
+template<DATRAW_NAMESPACE::scalar_type... Ts>
+DATRAW_DETAIL_NAMESPACE::convert_function
+DATRAW_DETAIL_NAMESPACE::get_convert_function(scalar_type_list_t<Ts...>,
+        const scalar_type src, const scalar_type dst) noexcept {
+    typedef scalar_type_list_t<Ts...> list_type;
+    constexpr auto size = sizeof...(Ts);
+    // The rows are indexed by the source type and the columns by the target
+    // type, both in the order of the type list.
+    static constexpr std::array<std::array<convert_function, size>, size>
+        table = {{ convert_row<Ts>(list_type())... }};
+
+    const auto s = get_scalar_index(list_type(), src);
+    const auto t = get_scalar_index(list_type(), dst);
+    return ((s < size) && (t < size)) ? table[s][t] : nullptr;
+}
+
+
+/*
+ * DATRAW_NAMESPACE::convert_window
+ */
+template<class T, class I, class O>
+void DATRAW_NAMESPACE::convert_window(I begin, I end, O dst,
+        const double min, const double max) {
+    typedef typename std::iterator_traits<I>::value_type S;
+    typedef detail::window_arithmetic_t<S, T> arithmetic_type;
+
+    if (max < min) {
+        std::stringstream msg;
+        msg << "The window [" << min << ", " << max << "] is empty."
+            << std::ends;
+        throw std::invalid_argument(msg.str());
+    }
+
+    const auto offset = static_cast<arithmetic_type>(min);
+    const auto scale = (max > min)
+        ? arithmetic_type(1) / (static_cast<arithmetic_type>(max) - offset)
+        : arithmetic_type(0);
+    const auto tmin = detail::is_floating_point<T>::value
+        ? arithmetic_type(0)
+        : static_cast<arithmetic_type>(std::numeric_limits<T>::lowest());
+    const auto trange = detail::is_floating_point<T>::value
+        ? arithmetic_type(1)
+        : static_cast<arithmetic_type>((std::numeric_limits<T>::max)())
+            - tmin;
+    // The maximum of 64-bit integers is not representable in double, but
+    // rounds up to a value that is out of range for T, so we need to clamp
+    // the result to the next smaller value in this case.
+    const auto tmax = (detail::is_floating_point<T>::value
+        || (std::numeric_limits<T>::digits
+            <= std::numeric_limits<arithmetic_type>::digits))
+        ? tmin + trange
+        : std::nextafter(tmin + trange, arithmetic_type(0));
+
+    // If there is a vectorised kernel for the combination of types, process
+    // the bulk of the data with it and leave the tail to the code below.
+    // The kernels exist only for types computed in single precision.
+    detail::window_vectorised<T>(begin, end, dst,
+        static_cast<float>(offset), static_cast<float>(scale));
+
+    while (begin != end) {
+        auto value = static_cast<arithmetic_type>(
+            static_cast<detail::arithmetic_t<S>>(*begin++));
+        value = (value - offset) * scale;
+        value = (std::min)((std::max)(value, arithmetic_type(0)),
+            arithmetic_type(1));
+        value = (std::min)(value * trange + tmin, tmax);
+        *dst++ = static_cast<T>(value);
+    }
+}
+
+
+/*
+ * DATRAW_NAMESPACE::convert_auto_range
+ */
+template<class T, class I, class O>
+std::pair<typename std::iterator_traits<I>::value_type,
+    typename std::iterator_traits<I>::value_type>
+DATRAW_NAMESPACE::convert_auto_range(I begin, I end, O dst) {
+    static_assert(std::is_base_of<std::forward_iterator_tag,
+        typename std::iterator_traits<I>::iterator_category>::value,
+        "The input must be a forward iterator.");
+    typedef typename std::iterator_traits<I>::value_type S;
+
+    const auto retval = DATRAW_NAMESPACE::find_range(begin, end);
+    DATRAW_NAMESPACE::convert_window<T>(begin, end, dst,
+        static_cast<double>(static_cast<detail::arithmetic_t<S>>(
+            retval.first)),
+        static_cast<double>(static_cast<detail::arithmetic_t<S>>(
+            retval.second)));
+    return retval;
+}
+
+
+/*
+ * DATRAW_NAMESPACE::find_range
+ */
+template<class I>
+std::pair<typename std::iterator_traits<I>::value_type,
+    typename std::iterator_traits<I>::value_type>
+DATRAW_NAMESPACE::find_range(I begin, I end) {
+    typedef typename std::iterator_traits<I>::value_type S;
+    std::pair<S, S> retval;
+
+    if (begin != end) {
+        retval.first = retval.second = *begin;
+
+        // The vectorised kernel processes the first element, too, so it can
+        // just replace the initial range.
+        detail::find_range_vectorised(begin, end, retval.first,
+            retval.second);
+
+        for (; begin != end; ++begin) {
+            const S value = *begin;
+            if (value < retval.first) {
+                retval.first = value;
+            }
+            if (retval.second < value) {
+                retval.second = value;
+            }
+        }
+    }
+
+    return retval;
+}
+
+
+/*
+ * DATRAW_NAMESPACE::copy_swap_byte_order
+ */
+void DATRAW_NAMESPACE::copy_swap_byte_order(const uint64 *src, uint64 *dst,
+        const std::size_t cnt) {
+    assert((src != nullptr) || (cnt == 0));
+    assert((dst != nullptr) || (cnt == 0));
+    const auto first = detail::byte_swap_vectorised<8>(src, dst, cnt);
+    for (size_t i = first; i < cnt; i++) {
+        auto v = src[i];
         auto sv = (v & 0x00000000000000FFULL);
         sv = ((v & 0x000000000000FF00ULL) >> 0x08) | (sv << 0x08);
         sv = ((v & 0x0000000000FF0000ULL) >> 0x10) | (sv << 0x08);
@@ -94,41 +320,117 @@ void DATRAW_NAMESPACE::swap_byte_order(uint64 *data, const std::size_t cnt) {
         sv = ((v & 0x0000FF0000000000ULL) >> 0x28) | (sv << 0x08);
         sv = ((v & 0x00FF000000000000ULL) >> 0x30) | (sv << 0x08);
         sv = ((v & 0xFF00000000000000ULL) >> 0x38) | (sv << 0x08);
-        data[i] = sv;
+        dst[i] = sv;
     }
 }
 
 
 /*
- * DATRAW_NAMESPACE::swap_byte_order
+ * DATRAW_NAMESPACE::copy_swap_byte_order
  */
-void DATRAW_NAMESPACE::swap_byte_order(uint32 *data, const std::size_t cnt) {
-    assert((data != nullptr) || (cnt == 0));
-    for (size_t i = 0; i < cnt; i++) {
-        auto v = data[i];
+void DATRAW_NAMESPACE::copy_swap_byte_order(const uint32 *src, uint32 *dst,
+        const std::size_t cnt) {
+    assert((src != nullptr) || (cnt == 0));
+    assert((dst != nullptr) || (cnt == 0));
+    const auto first = detail::byte_swap_vectorised<4>(src, dst, cnt);
+    for (size_t i = first; i < cnt; i++) {
+        auto v = src[i];
         auto sv = (v & 0x000000FF);
         sv = ((v & 0x0000FF00) >> 0x08) | (sv << 0x08);
         sv = ((v & 0x00FF0000) >> 0x10) | (sv << 0x08);
         sv = ((v & 0xFF000000) >> 0x18) | (sv << 0x08);
-        data[i] = sv;
+        dst[i] = sv;
     }
 }
 
 
 /*
- * DATRAW_NAMESPACE::swap_byte_order
+ * DATRAW_NAMESPACE::copy_swap_byte_order
  */
-void DATRAW_NAMESPACE::swap_byte_order(uint16 *data, const std::size_t cnt) {
-    assert((data != nullptr) || (cnt == 0));
-    for (size_t i = 0; i < cnt; i++) {
-        auto v = data[i];
+void DATRAW_NAMESPACE::copy_swap_byte_order(const uint16 *src, uint16 *dst,
+        const std::size_t cnt) {
+    assert((src != nullptr) || (cnt == 0));
+    assert((dst != nullptr) || (cnt == 0));
+    const auto first = detail::byte_swap_vectorised<2>(src, dst, cnt);
+    for (size_t i = first; i < cnt; i++) {
+        auto v = src[i];
         auto sv = static_cast<uint16>(v & 0x00FF);
         sv = ((v & 0xFF00) >> 0x08) | (sv << 0x08);
-        data[i] = sv;
+        dst[i] = sv;
     }
 }
 
 
+/*
+ * DATRAW_NAMESPACE::copy_swap_byte_order
+ */
+void DATRAW_NAMESPACE::copy_swap_byte_order(const std::size_t width,
+        const void *src, void *dst, const std::size_t cnt) {
+    switch (width) {
+        case 8:
+            copy_swap_byte_order(static_cast<const uint64 *>(src),
+                static_cast<uint64 *>(dst), cnt);
+            break;
+
+        case 4:
+            copy_swap_byte_order(static_cast<const uint32 *>(src),
+                static_cast<uint32 *>(dst), cnt);
+            break;
+
+        case 2:
+            copy_swap_byte_order(static_cast<const uint16 *>(src),
+                static_cast<uint16 *>(dst), cnt);
+            break;
+
+        default:
+            if ((cnt > 0) && (src != dst)) {
+                std::memcpy(dst, src, width * cnt);
+            }
+            break;
+    }
+}
+
+
+/*
+ * DATRAW_NAMESPACE::copy_swap_byte_order
+ */
+void DATRAW_NAMESPACE::copy_swap_byte_order(const std::size_t width,
+        const void *src, void *dst, const std::size_t cnt,
+        const std::size_t concurrency) {
+    auto s = static_cast<const uint8 *>(src);
+    auto d = static_cast<uint8 *>(dst);
+    const auto w = (std::max)(width, std::size_t(1));
+    detail::parallel_chunks(cnt, detail::parallel_chunk_size() / w,
+            concurrency, [=](const std::size_t b, const std::size_t e) {
+        copy_swap_byte_order(width, s + b * w, d + b * w, e - b);
+    });
+}
+
+
+/*
+ * DATRAW_NAMESPACE::swap_byte_order
+ */
+void DATRAW_NAMESPACE::swap_byte_order(uint64 *data, const std::size_t cnt) {
+    copy_swap_byte_order(data, data, cnt);
+}
+
+
+/*
+ * DATRAW_NAMESPACE::swap_byte_order
+ */
+void DATRAW_NAMESPACE::swap_byte_order(uint32 *data, const std::size_t cnt) {
+    copy_swap_byte_order(data, data, cnt);
+}
+
+
+/*
+ * DATRAW_NAMESPACE::swap_byte_order
+ */
+void DATRAW_NAMESPACE::swap_byte_order(uint16 *data, const std::size_t cnt) {
+    copy_swap_byte_order(data, data, cnt);
+}
+
+
 /*
  * DATRAW_NAMESPACE::swap_byte_order
  */
@@ -141,3 +443,12 @@ void DATRAW_NAMESPACE::swap_byte_order(const std::size_t width, void *data,
         default: /* Do nothing */ break;
     }
 }
+
+
+/*
+ * DATRAW_NAMESPACE::swap_byte_order
+ */
+void DATRAW_NAMESPACE::swap_byte_order(const std::size_t width, void *data,
+        const std::size_t cnt, const std::size_t concurrency) {
+    copy_swap_byte_order(width, data, data, cnt, concurrency);
+}
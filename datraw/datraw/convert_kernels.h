@@ -0,0 +1,768 @@
+﻿// <copyright file="convert_kernels.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2026 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_DATRAW_CONVERT_KERNELS_H)
+#define _DATRAW_CONVERT_KERNELS_H
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include "datraw/cpu_features.h"
+#include "datraw/types.h"
+
+
+DATRAW_DETAIL_NAMESPACE_BEGIN
+
+#if defined(DATRAW_X86_KERNELS)
+/// <summary>
+/// Divides eight 32-bit integers by <paramref name="range" /> like the
+/// scalar conversion from integral to floating-point types does.
+/// </summary>
+DATRAW_TARGET("avx2") inline __m256 convert_normalise_avx2(const __m256i v,
+        const __m256 range) noexcept {
+    return _mm256_div_ps(_mm256_cvtepi32_ps(v), range);
+}
+
+
+/// <summary>
+/// Scales eight floating-point numbers to <paramref name="range" /> and
+/// truncates them to 32-bit integers like the scalar conversion from
+/// floating-point to integral types does.
+/// </summary>
+DATRAW_TARGET("avx2") inline __m256i convert_scale_avx2(const float *src,
+        const __m256 range) noexcept {
+    return _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_loadu_ps(src), range));
+}
+
+
+/// <summary>
+/// Converts <c>std::uint8_t</c> to <c>float</c> in blocks of eight.
+/// </summary>
+DATRAW_TARGET("avx2") inline std::size_t convert_avx2(const std::uint8_t *src,
+        const std::size_t cnt, float *dst) noexcept {
+    const auto range = _mm256_set1_ps(255.0f);
+    const auto size = cnt & ~std::size_t(7);
+
+    for (std::size_t i = 0; i < size; i += 8) {
+        const auto v = _mm256_cvtepu8_epi32(_mm_loadl_epi64(
+            reinterpret_cast<const __m128i *>(src + i)));
+        _mm256_storeu_ps(dst + i, convert_normalise_avx2(v, range));
+    }
+
+    return size;
+}
+
+
+/// <summary>
+/// Converts <c>std::uint16_t</c> to <c>float</c> in blocks of eight.
+/// </summary>
+DATRAW_TARGET("avx2") inline std::size_t convert_avx2(const std::uint16_t *src,
+        const std::size_t cnt, float *dst) noexcept {
+    const auto range = _mm256_set1_ps(65535.0f);
+    const auto size = cnt & ~std::size_t(7);
+
+    for (std::size_t i = 0; i < size; i += 8) {
+        const auto v = _mm256_cvtepu16_epi32(_mm_loadu_si128(
+            reinterpret_cast<const __m128i *>(src + i)));
+        _mm256_storeu_ps(dst + i, convert_normalise_avx2(v, range));
+    }
+
+    return size;
+}
+
+
+/// <summary>
+/// Converts <c>std::int16_t</c> to <c>float</c> in blocks of eight.
+/// </summary>
+DATRAW_TARGET("avx2") inline std::size_t convert_avx2(const std::int16_t *src,
+        const std::size_t cnt, float *dst) noexcept {
+    const auto range = _mm256_set1_ps(65535.0f);
+    const auto size = cnt & ~std::size_t(7);
+
+    for (std::size_t i = 0; i < size; i += 8) {
+        const auto v = _mm256_cvtepi16_epi32(_mm_loadu_si128(
+            reinterpret_cast<const __m128i *>(src + i)));
+        _mm256_storeu_ps(dst + i, convert_normalise_avx2(v, range));
+    }
+
+    return size;
+}
+
+
+/// <summary>
+/// Converts <c>float</c> to <c>std::uint8_t</c> in blocks of 16.
+/// </summary>
+/// <remarks>
+/// Values outside [0, 1], for which the scalar conversion is undefined, are
+/// saturated.
+/// </remarks>
+DATRAW_TARGET("avx2") inline std::size_t convert_avx2(const float *src,
+        const std::size_t cnt, std::uint8_t *dst) noexcept {
+    const auto range = _mm256_set1_ps(255.0f);
+    const auto size = cnt & ~std::size_t(15);
+
+    for (std::size_t i = 0; i < size; i += 16) {
+        const auto lo = convert_scale_avx2(src + i, range);
+        const auto hi = convert_scale_avx2(src + i + 8, range);
+        // The packs work per 128-bit lane, so the result needs to be
+        // reordered before storing its lower half.
+        const auto w = _mm256_permute4x64_epi64(_mm256_packus_epi32(lo, hi),
+            _MM_SHUFFLE(3, 1, 2, 0));
+        const auto b = _mm256_packus_epi16(w, w);
+        const auto r = _mm256_permute4x64_epi64(b, _MM_SHUFFLE(3, 1, 2, 0));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i),
+            _mm256_castsi256_si128(r));
+    }
+
+    return size;
+}
+
+
+/// <summary>
+/// Converts <c>float</c> to <c>std::uint16_t</c> in blocks of 16.
+/// </summary>
+/// <remarks>
+/// Values outside [0, 1], for which the scalar conversion is undefined, are
+/// saturated.
+/// </remarks>
+DATRAW_TARGET("avx2") inline std::size_t convert_avx2(const float *src,
+        const std::size_t cnt, std::uint16_t *dst) noexcept {
+    const auto range = _mm256_set1_ps(65535.0f);
+    const auto size = cnt & ~std::size_t(15);
+
+    for (std::size_t i = 0; i < size; i += 16) {
+        const auto lo = convert_scale_avx2(src + i, range);
+        const auto hi = convert_scale_avx2(src + i + 8, range);
+        const auto w = _mm256_permute4x64_epi64(_mm256_packus_epi32(lo, hi),
+            _MM_SHUFFLE(3, 1, 2, 0));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), w);
+    }
+
+    return size;
+}
+
+
+/// <summary>
+/// Converts <c>std::uint16_t</c> to <c>std::uint8_t</c> in blocks of eight.
+/// </summary>
+/// <remarks>
+/// The conversion uses the same double-precision arithmetic as the scalar
+/// one in order to produce the same rounding.
+/// </remarks>
+DATRAW_TARGET("avx2") inline std::size_t convert_avx2(const std::uint16_t *src,
+        const std::size_t cnt, std::uint8_t *dst) noexcept {
+    const auto srange = _mm256_set1_pd(65535.0);
+    const auto trange = _mm256_set1_pd(255.0);
+    const auto size = cnt & ~std::size_t(7);
+
+    for (std::size_t i = 0; i < size; i += 8) {
+        const auto v = _mm_cvtepu16_epi32(_mm_loadl_epi64(
+            reinterpret_cast<const __m128i *>(src + i)));
+        const auto w = _mm_cvtepu16_epi32(_mm_loadl_epi64(
+            reinterpret_cast<const __m128i *>(src + i + 4)));
+        const auto lo = _mm256_cvttpd_epi32(_mm256_mul_pd(_mm256_div_pd(
+            _mm256_cvtepi32_pd(v), srange), trange));
+        const auto hi = _mm256_cvttpd_epi32(_mm256_mul_pd(_mm256_div_pd(
+            _mm256_cvtepi32_pd(w), srange), trange));
+        const auto h = _mm_packus_epi32(lo, hi);
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(dst + i),
+            _mm_packus_epi16(h, h));
+    }
+
+    return size;
+}
+#endif /* defined(DATRAW_X86_KERNELS) */
+
+
+/// <summary>
+/// Converts as many of the <paramref name="cnt" /> elements as possible from
+/// <typeparamref name="S" /> to <typeparamref name="T" /> using the best
+/// vector instructions the CPU supports.
+/// </summary>
+/// <remarks>
+/// The default implementation has no kernel and processes nothing.
+/// </remarks>
+template<class S, class T> struct convert_kernel final {
+    static inline std::size_t apply(const S *, const std::size_t,
+            T *) noexcept {
+        return 0;
+    }
+};
+
+
+#if defined(DATRAW_X86_KERNELS)
+/// <summary>
+/// Declares a <see cref="convert_kernel" /> that dispatches to the AVX2
+/// implementation if the CPU supports it.
+/// </summary>
+#define _DATRAW_AVX2_CONVERT_KERNEL(S, T)\
+    template<> struct convert_kernel<S, T> final {\
+        static inline std::size_t apply(const S *src, const std::size_t cnt,\
+                T *dst) noexcept {\
+            return cpu_features::instance().avx2\
+                ? convert_avx2(src, cnt, dst)\
+                : 0;\
+        }\
+    }
+
+_DATRAW_AVX2_CONVERT_KERNEL(std::uint8_t, float);
+_DATRAW_AVX2_CONVERT_KERNEL(std::uint16_t, float);
+_DATRAW_AVX2_CONVERT_KERNEL(std::int16_t, float);
+_DATRAW_AVX2_CONVERT_KERNEL(float, std::uint8_t);
+_DATRAW_AVX2_CONVERT_KERNEL(float, std::uint16_t);
+_DATRAW_AVX2_CONVERT_KERNEL(std::uint16_t, std::uint8_t);
+
+#undef _DATRAW_AVX2_CONVERT_KERNEL
+#endif /* defined(DATRAW_X86_KERNELS) */
+
+
+/// <summary>
+/// Widens half-precision numbers to single precision using F16C, AVX-512 or
+/// NEON.
+/// </summary>
+template<> struct convert_kernel<float16, float> final {
+    static inline std::size_t apply(const float16 *src, const std::size_t cnt,
+            float *dst) noexcept {
+        return half_to_float_vectorised(
+            reinterpret_cast<const std::uint16_t *>(src), dst, cnt);
+    }
+};
+
+
+/// <summary>
+/// Narrows single-precision numbers to half precision using F16C, AVX-512
+/// or NEON.
+/// </summary>
+template<> struct convert_kernel<float, float16> final {
+    static inline std::size_t apply(const float *src, const std::size_t cnt,
+            float16 *dst) noexcept {
+        return float_to_half_vectorised(src,
+            reinterpret_cast<std::uint16_t *>(dst), cnt);
+    }
+};
+
+
+/// <summary>
+/// Chains the <see cref="convert_kernel" />s from <typeparamref name="S" />
+/// to <c>float</c> and from <c>float</c> to <typeparamref name="T" /> using
+/// a small buffer that stays in the L1 cache.
+/// </summary>
+/// <remarks>
+/// Only complete blocks of the buffer size are processed, and only as long
+/// as both kernels process the whole block.
+/// </remarks>
+template<class S, class T> struct convert_kernel_via_float {
+    static inline std::size_t apply(const S *src, const std::size_t cnt,
+            T *dst) noexcept {
+        std::array<float, 256> buffer;
+        std::size_t retval = 0;
+
+        while (cnt - retval >= buffer.size()) {
+            if (convert_kernel<S, float>::apply(src + retval, buffer.size(),
+                    buffer.data()) < buffer.size()) {
+                break;
+            }
+            if (convert_kernel<float, T>::apply(buffer.data(), buffer.size(),
+                    dst + retval) < buffer.size()) {
+                break;
+            }
+            retval += buffer.size();
+        }
+
+        return retval;
+    }
+};
+
+template<> struct convert_kernel<float16, std::uint8_t> final
+    : convert_kernel_via_float<float16, std::uint8_t> { };
+template<> struct convert_kernel<float16, std::uint16_t> final
+    : convert_kernel_via_float<float16, std::uint16_t> { };
+template<> struct convert_kernel<std::uint8_t, float16> final
+    : convert_kernel_via_float<std::uint8_t, float16> { };
+template<> struct convert_kernel<std::uint16_t, float16> final
+    : convert_kernel_via_float<std::uint16_t, float16> { };
+template<> struct convert_kernel<std::int16_t, float16> final
+    : convert_kernel_via_float<std::int16_t, float16> { };
+
+
+#if defined(DATRAW_X86_KERNELS)
+/// <summary>
+/// Loads eight <c>std::uint8_t</c> as <c>float</c>.
+/// </summary>
+DATRAW_TARGET("avx2") inline __m256 window_load_avx2(
+        const std::uint8_t *src) noexcept {
+    return _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64(
+        reinterpret_cast<const __m128i *>(src))));
+}
+
+
+/// <summary>
+/// Loads eight <c>std::uint16_t</c> as <c>float</c>.
+/// </summary>
+DATRAW_TARGET("avx2") inline __m256 window_load_avx2(
+        const std::uint16_t *src) noexcept {
+    return _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm_loadu_si128(
+        reinterpret_cast<const __m128i *>(src))));
+}
+
+
+/// <summary>
+/// Loads eight <c>std::int16_t</c> as <c>float</c>.
+/// </summary>
+DATRAW_TARGET("avx2") inline __m256 window_load_avx2(
+        const std::int16_t *src) noexcept {
+    return _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm_loadu_si128(
+        reinterpret_cast<const __m128i *>(src))));
+}
+
+
+/// <summary>
+/// Loads eight <c>float</c>s.
+/// </summary>
+DATRAW_TARGET("avx2") inline __m256 window_load_avx2(
+        const float *src) noexcept {
+    return _mm256_loadu_ps(src);
+}
+
+
+/// <summary>
+/// Stores eight values within [0, 1] as <c>float</c>.
+/// </summary>
+DATRAW_TARGET("avx2") inline void window_store_avx2(const __m256 v,
+        float *dst) noexcept {
+    _mm256_storeu_ps(dst, v);
+}
+
+
+/// <summary>
+/// Scales eight values within [0, 1] to the range of <c>std::uint8_t</c>
+/// and stores them.
+/// </summary>
+DATRAW_TARGET("avx2") inline void window_store_avx2(const __m256 v,
+        std::uint8_t *dst) noexcept {
+    const auto i = _mm256_cvttps_epi32(_mm256_mul_ps(v,
+        _mm256_set1_ps(255.0f)));
+    const auto w = _mm_packus_epi32(_mm256_castsi256_si128(i),
+        _mm256_extracti128_si256(i, 1));
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(dst),
+        _mm_packus_epi16(w, w));
+}
+
+
+/// <summary>
+/// Scales eight values within [0, 1] to the range of <c>std::uint16_t</c>
+/// and stores them.
+/// </summary>
+DATRAW_TARGET("avx2") inline void window_store_avx2(const __m256 v,
+        std::uint16_t *dst) noexcept {
+    const auto i = _mm256_cvttps_epi32(_mm256_mul_ps(v,
+        _mm256_set1_ps(65535.0f)));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm_packus_epi32(
+        _mm256_castsi256_si128(i), _mm256_extracti128_si256(i, 1)));
+}
+
+
+/// <summary>
+/// Maps the window starting at <paramref name="min" /> to [0, 1] in blocks
+/// of eight and converts the result to <typeparamref name="T" /> like
+/// <see cref="convert_window" /> does.
+/// </summary>
+template<class S, class T>
+DATRAW_TARGET("avx2") std::size_t convert_window_avx2(const S *src,
+        const std::size_t cnt, T *dst, const float min,
+        const float scale) noexcept {
+    const auto zero = _mm256_setzero_ps();
+    const auto one = _mm256_set1_ps(1.0f);
+    const auto offset = _mm256_set1_ps(min);
+    const auto factor = _mm256_set1_ps(scale);
+    const auto size = cnt & ~std::size_t(7);
+
+    for (std::size_t i = 0; i < size; i += 8) {
+        auto v = _mm256_mul_ps(_mm256_sub_ps(window_load_avx2(src + i),
+            offset), factor);
+        v = _mm256_min_ps(_mm256_max_ps(v, zero), one);
+        window_store_avx2(v, dst + i);
+    }
+
+    return size;
+}
+
+
+/// <summary>
+/// Reduces the lanes of <paramref name="lo" /> and <paramref name="hi" />
+/// to the minimum and maximum.
+/// </summary>
+template<class S, std::size_t N>
+inline void find_range_reduce(const std::array<S, N>& lo,
+        const std::array<S, N>& hi, S& min, S& max) noexcept {
+    min = *std::min_element(lo.begin(), lo.end());
+    max = *std::max_element(hi.begin(), hi.end());
+}
+
+
+/// <summary>
+/// Determines the range of all complete blocks of 32 <c>std::uint8_t</c>.
+/// </summary>
+DATRAW_TARGET("avx2") inline std::size_t find_range_avx2(
+        const std::uint8_t *src, const std::size_t cnt, std::uint8_t& min,
+        std::uint8_t& max) noexcept {
+    const auto size = cnt & ~std::size_t(31);
+    if (size == 0) {
+        return 0;
+    }
+
+    auto lo = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src));
+    auto hi = lo;
+    for (std::size_t i = 32; i < size; i += 32) {
+        const auto v = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i *>(src + i));
+        lo = _mm256_min_epu8(lo, v);
+        hi = _mm256_max_epu8(hi, v);
+    }
+
+    std::array<std::uint8_t, 32> l, h;
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(l.data()), lo);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(h.data()), hi);
+    find_range_reduce(l, h, min, max);
+    return size;
+}
+
+
+/// <summary>
+/// Determines the range of all complete blocks of 16
+/// <c>std::uint16_t</c>.
+/// </summary>
+DATRAW_TARGET("avx2") inline std::size_t find_range_avx2(
+        const std::uint16_t *src, const std::size_t cnt, std::uint16_t& min,
+        std::uint16_t& max) noexcept {
+    const auto size = cnt & ~std::size_t(15);
+    if (size == 0) {
+        return 0;
+    }
+
+    auto lo = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src));
+    auto hi = lo;
+    for (std::size_t i = 16; i < size; i += 16) {
+        const auto v = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i *>(src + i));
+        lo = _mm256_min_epu16(lo, v);
+        hi = _mm256_max_epu16(hi, v);
+    }
+
+    std::array<std::uint16_t, 16> l, h;
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(l.data()), lo);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(h.data()), hi);
+    find_range_reduce(l, h, min, max);
+    return size;
+}
+
+
+/// <summary>
+/// Determines the range of all complete blocks of 16 <c>std::int16_t</c>.
+/// </summary>
+DATRAW_TARGET("avx2") inline std::size_t find_range_avx2(
+        const std::int16_t *src, const std::size_t cnt, std::int16_t& min,
+        std::int16_t& max) noexcept {
+    const auto size = cnt & ~std::size_t(15);
+    if (size == 0) {
+        return 0;
+    }
+
+    auto lo = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src));
+    auto hi = lo;
+    for (std::size_t i = 16; i < size; i += 16) {
+        const auto v = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i *>(src + i));
+        lo = _mm256_min_epi16(lo, v);
+        hi = _mm256_max_epi16(hi, v);
+    }
+
+    std::array<std::int16_t, 16> l, h;
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(l.data()), lo);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(h.data()), hi);
+    find_range_reduce(l, h, min, max);
+    return size;
+}
+
+
+/// <summary>
+/// Determines the range of all complete blocks of eight <c>float</c>s.
+/// </summary>
+DATRAW_TARGET("avx2") inline std::size_t find_range_avx2(const float *src,
+        const std::size_t cnt, float& min, float& max) noexcept {
+    const auto size = cnt & ~std::size_t(7);
+    if (size == 0) {
+        return 0;
+    }
+
+    auto lo = _mm256_loadu_ps(src);
+    auto hi = lo;
+    for (std::size_t i = 8; i < size; i += 8) {
+        const auto v = _mm256_loadu_ps(src + i);
+        lo = _mm256_min_ps(v, lo);
+        hi = _mm256_max_ps(v, hi);
+    }
+
+    std::array<float, 8> l, h;
+    _mm256_storeu_ps(l.data(), lo);
+    _mm256_storeu_ps(h.data(), hi);
+    find_range_reduce(l, h, min, max);
+    return size;
+}
+#endif /* defined(DATRAW_X86_KERNELS) */
+
+
+/// <summary>
+/// Maps as many of the <paramref name="cnt" /> elements as possible from
+/// the window starting at <paramref name="min" /> to
+/// <typeparamref name="T" /> using the best vector instructions the CPU
+/// supports.
+/// </summary>
+/// <remarks>
+/// The default implementation has no kernel and processes nothing.
+/// </remarks>
+template<class S, class T> struct window_kernel final {
+    static inline std::size_t apply(const S *, const std::size_t, T *,
+            const float, const float) noexcept {
+        return 0;
+    }
+};
+
+
+/// <summary>
+/// Determines the range of as many of the <paramref name="cnt" /> elements
+/// as possible using the best vector instructions the CPU supports.
+/// </summary>
+/// <remarks>
+/// The default implementation has no kernel and processes nothing.
+/// </remarks>
+template<class S> struct range_kernel final {
+    static inline std::size_t apply(const S *, const std::size_t, S&,
+            S&) noexcept {
+        return 0;
+    }
+};
+
+
+#if defined(DATRAW_X86_KERNELS)
+/// <summary>
+/// Declares a <see cref="window_kernel" /> that dispatches to the AVX2
+/// implementation if the CPU supports it.
+/// </summary>
+#define _DATRAW_AVX2_WINDOW_KERNEL(S, T)\
+    template<> struct window_kernel<S, T> final {\
+        static inline std::size_t apply(const S *src, const std::size_t cnt,\
+                T *dst, const float min, const float scale) noexcept {\
+            return cpu_features::instance().avx2\
+                ? convert_window_avx2(src, cnt, dst, min, scale)\
+                : 0;\
+        }\
+    }
+
+_DATRAW_AVX2_WINDOW_KERNEL(std::uint8_t, float);
+_DATRAW_AVX2_WINDOW_KERNEL(std::uint8_t, std::uint8_t);
+_DATRAW_AVX2_WINDOW_KERNEL(std::uint8_t, std::uint16_t);
+_DATRAW_AVX2_WINDOW_KERNEL(std::uint16_t, float);
+_DATRAW_AVX2_WINDOW_KERNEL(std::uint16_t, std::uint8_t);
+_DATRAW_AVX2_WINDOW_KERNEL(std::uint16_t, std::uint16_t);
+_DATRAW_AVX2_WINDOW_KERNEL(std::int16_t, float);
+_DATRAW_AVX2_WINDOW_KERNEL(std::int16_t, std::uint8_t);
+_DATRAW_AVX2_WINDOW_KERNEL(std::int16_t, std::uint16_t);
+_DATRAW_AVX2_WINDOW_KERNEL(float, float);
+_DATRAW_AVX2_WINDOW_KERNEL(float, std::uint8_t);
+_DATRAW_AVX2_WINDOW_KERNEL(float, std::uint16_t);
+
+#undef _DATRAW_AVX2_WINDOW_KERNEL
+
+
+/// <summary>
+/// Declares a <see cref="range_kernel" /> that dispatches to the AVX2
+/// implementation if the CPU supports it.
+/// </summary>
+#define _DATRAW_AVX2_RANGE_KERNEL(S)\
+    template<> struct range_kernel<S> final {\
+        static inline std::size_t apply(const S *src, const std::size_t cnt,\
+                S& min, S& max) noexcept {\
+            return cpu_features::instance().avx2\
+                ? find_range_avx2(src, cnt, min, max)\
+                : 0;\
+        }\
+    }
+
+_DATRAW_AVX2_RANGE_KERNEL(std::uint8_t);
+_DATRAW_AVX2_RANGE_KERNEL(std::uint16_t);
+_DATRAW_AVX2_RANGE_KERNEL(std::int16_t);
+_DATRAW_AVX2_RANGE_KERNEL(float);
+
+#undef _DATRAW_AVX2_RANGE_KERNEL
+#endif /* defined(DATRAW_X86_KERNELS) */
+
+
+/// <summary>
+/// Determines whether <typeparamref name="I" /> is an iterator of
+/// <c>std::array</c> in the MSVC standard library, which is not a pointer
+/// unlike in other implementations.
+/// </summary>
+template<class I> struct is_msvc_array_iterator : std::false_type { };
+
+#if defined(_MSC_VER)
+template<class T, std::size_t N>
+struct is_msvc_array_iterator<std::_Array_iterator<T, N>> : std::true_type { };
+
+template<class T, std::size_t N>
+struct is_msvc_array_iterator<std::_Array_const_iterator<T, N>>
+    : std::true_type { };
+#endif /* defined(_MSC_VER) */
+
+
+/// <summary>
+/// Determines whether <typeparamref name="I" /> is an iterator of a standard
+/// container that stores its elements contiguously, which can therefore be
+/// processed by the vectorised kernels via the address of the elements.
+/// </summary>
+/// <remarks>
+/// Only arithmetic element types and <see cref="float16" /> are considered,
+/// for which there are kernels. <c>std::vector&lt;bool&gt;</c> is not
+/// contiguous. The iterators of <c>std::array</c> are pointers except for
+/// MSVC, which is handled by <see cref="is_msvc_array_iterator" />.
+/// </remarks>
+template<class I, class V = typename std::iterator_traits<I>::value_type,
+    class = void>
+struct is_contiguous_iterator : std::is_pointer<I> { };
+
+template<class I, class V>
+struct is_contiguous_iterator<I, V, typename std::enable_if<
+        (std::is_arithmetic<V>::value || std::is_same<V, float16>::value)
+        && !std::is_same<V, bool>::value>::type>
+    : std::integral_constant<bool, std::is_pointer<I>::value
+        || is_msvc_array_iterator<I>::value
+        || std::is_same<I, typename std::vector<V>::iterator>::value
+        || std::is_same<I, typename std::vector<V>::const_iterator>::value>
+    { };
+
+
+/// <summary>
+/// Converts the bulk of the range [<paramref name="begin" />,
+/// <paramref name="end" />[ using a <see cref="convert_kernel" /> and
+/// advances <paramref name="begin" /> and <paramref name="dst" /> past the
+/// elements that have been processed.
+/// </summary>
+template<class T, class S>
+inline void convert_vectorised(S *& begin, S * const& end, T *& dst) noexcept {
+    typedef typename std::remove_const<S>::type source_type;
+    const auto cnt = convert_kernel<source_type, T>::apply(begin,
+        static_cast<std::size_t>(end - begin), dst);
+    begin += cnt;
+    dst += cnt;
+}
+
+
+/// <summary>
+/// Fallback for iterators that are not contiguous, which cannot be processed
+/// by vector instructions.
+/// </summary>
+template<class T, class I, class O>
+inline void convert_vectorised(I&, const I&, O&, std::false_type) noexcept { }
+
+
+/// <summary>
+/// Converts the bulk of the range [<paramref name="begin" />,
+/// <paramref name="end" />[ of a contiguous container using the addresses
+/// of the elements and advances the iterators like the variant for pointers.
+/// </summary>
+template<class T, class I, class O>
+inline void convert_vectorised(I& begin, const I& end, O& dst,
+        std::true_type) noexcept {
+    if (begin != end) {
+        auto b = &*begin;
+        auto e = b + (end - begin);
+        auto d = &*dst;
+        convert_vectorised<T>(b, e, d);
+        const auto cnt = b - &*begin;
+        begin += cnt;
+        dst += cnt;
+    }
+}
+
+
+/// <summary>
+/// Dispatches iterators that are not pointers to the variant for contiguous
+/// containers if possible or does nothing otherwise.
+/// </summary>
+template<class T, class I, class O>
+inline void convert_vectorised(I& begin, const I& end, O& dst) noexcept {
+    typedef std::integral_constant<bool,
+        is_contiguous_iterator<I>::value
+        && is_contiguous_iterator<O>::value
+        && std::is_same<typename std::iterator_traits<O>::value_type,
+            T>::value>
+        contiguous_tag;
+    convert_vectorised<T>(begin, end, dst, contiguous_tag());
+}
+
+
+/// <summary>
+/// Fallback for iterators that are not pointers, which cannot be processed
+/// by vector instructions.
+/// </summary>
+template<class I, class S>
+inline void find_range_vectorised(I&, const I&, S&, S&) noexcept { }
+
+
+/// <summary>
+/// Determines the range of the bulk of [<paramref name="begin" />,
+/// <paramref name="end" />[ using a <see cref="range_kernel" /> and
+/// advances <paramref name="begin" /> past the elements that have been
+/// processed.
+/// </summary>
+/// <remarks>
+/// <paramref name="min" /> and <paramref name="max" /> are only changed if
+/// at least one element has been processed.
+/// </remarks>
+template<class S>
+inline void find_range_vectorised(S *& begin, S * const& end,
+        typename std::remove_const<S>::type& min,
+        typename std::remove_const<S>::type& max) noexcept {
+    typedef typename std::remove_const<S>::type source_type;
+    begin += range_kernel<source_type>::apply(begin,
+        static_cast<std::size_t>(end - begin), min, max);
+}
+
+
+/// <summary>
+/// Fallback for iterators that are not pointers, which cannot be processed
+/// by vector instructions.
+/// </summary>
+template<class T, class I, class O>
+inline void window_vectorised(I&, const I&, O&, const float,
+    const float) noexcept { }
+
+
+/// <summary>
+/// Converts the bulk of the range [<paramref name="begin" />,
+/// <paramref name="end" />[ using a <see cref="window_kernel" /> and
+/// advances <paramref name="begin" /> and <paramref name="dst" /> past the
+/// elements that have been processed.
+/// </summary>
+template<class T, class S>
+inline void window_vectorised(S *& begin, S * const& end, T *& dst,
+        const float min, const float scale) noexcept {
+    typedef typename std::remove_const<S>::type source_type;
+    const auto cnt = window_kernel<source_type, T>::apply(begin,
+        static_cast<std::size_t>(end - begin), dst, min, scale);
+    begin += cnt;
+    dst += cnt;
+}
+
+DATRAW_DETAIL_NAMESPACE_END
+
+#endif /* !defined(_DATRAW_CONVERT_KERNELS_H) */
@@ -0,0 +1,162 @@
+﻿// <copyright file="cpu_features.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2026 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_DATRAW_CPU_FEATURES_H)
+#define _DATRAW_CPU_FEATURES_H
+#pragma once
+
+#include "datraw/abi.h"
+
+
+#if (defined(__x86_64__) || defined(_M_X64))
+/// <summary>
+/// Indicates that the SSE/AVX kernels are available, which we only do for
+/// 64-bit builds where SSE2 is part of the baseline.
+/// </summary>
+#define DATRAW_X86_KERNELS
+#endif /* (defined(__x86_64__) || defined(_M_X64)) */
+
+#if (defined(__ARM_NEON) || defined(_M_ARM64))
+/// <summary>
+/// Indicates that the NEON kernels are available, which is the case for all
+/// AArch64 targets and therefore requires no runtime dispatch.
+/// </summary>
+#define DATRAW_NEON_KERNELS
+#endif /* (defined(__ARM_NEON) || defined(_M_ARM64)) */
+
+
+#if defined(DATRAW_X86_KERNELS)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif /* defined(_MSC_VER) */
+#include <immintrin.h>
+#endif /* defined(DATRAW_X86_KERNELS) */
+
+#if defined(DATRAW_NEON_KERNELS)
+#include <arm_neon.h>
+#endif /* defined(DATRAW_NEON_KERNELS) */
+
+
+#if (defined(__GNUC__) || defined(__clang__))
+/// <summary>
+/// Enables the instruction set <paramref name="isa" /> for a single function
+/// without requiring the whole translation unit to be compiled for it.
+/// </summary>
+/// <remarks>
+/// MSVC allows for using all intrinsics without enabling them, so the macro
+/// expands to nothing there.
+/// </remarks>
+#define DATRAW_TARGET(isa) __attribute__((target(isa)))
+#else /* (defined(__GNUC__) || defined(__clang__)) */
+#define DATRAW_TARGET(isa)
+#endif /* (defined(__GNUC__) || defined(__clang__)) */
+
+
+DATRAW_DETAIL_NAMESPACE_BEGIN
+
+/// <summary>
+/// The instruction set extensions of the CPU we are running on that are
+/// relevant for our kernels.
+/// </summary>
+/// <remarks>
+/// The features are detected once on first use. A feature is only reported
+/// if the operating system also saves the respective registers on a context
+/// switch.
+/// </remarks>
+struct cpu_features final {
+
+    /// <summary>
+    /// Answer the features of the CPU the process is running on.
+    /// </summary>
+    /// <returns>The features of the CPU.</returns>
+    static inline const cpu_features& instance(void) {
+        static const cpu_features retval;
+        return retval;
+    }
+
+    /// <summary>
+    /// AVX2 is supported.
+    /// </summary>
+    bool avx2;
+
+    /// <summary>
+    /// AVX-512 foundation and the byte and word instructions are supported.
+    /// </summary>
+    bool avx512bw;
+
+    /// <summary>
+    /// The AVX-512 foundation instructions are supported.
+    /// </summary>
+    bool avx512f;
+
+    /// <summary>
+    /// The conversion instructions between half and single precision are
+    /// supported.
+    /// </summary>
+    bool f16c;
+
+    /// <summary>
+    /// NEON is supported.
+    /// </summary>
+    bool neon;
+
+    /// <summary>
+    /// SSSE3 is supported.
+    /// </summary>
+    bool ssse3;
+
+private:
+
+    /// <summary>
+    /// Initialises a new instance by querying the CPU.
+    /// </summary>
+    inline cpu_features(void) noexcept : avx2(false), avx512bw(false),
+            avx512f(false), f16c(false), neon(false), ssse3(false) {
+#if (defined(DATRAW_X86_KERNELS) && defined(_MSC_VER))
+        int info[4];
+        ::__cpuid(info, 0);
+        const auto maxLeaf = info[0];
+
+        ::__cpuid(info, 1);
+        this->ssse3 = ((info[2] & (1 << 9)) != 0);
+        const auto osxsave = ((info[2] & (1 << 27)) != 0);
+        const auto avx = ((info[2] & (1 << 28)) != 0);
+        const auto f16c = ((info[2] & (1 << 29)) != 0);
+
+        if (osxsave && avx) {
+            const auto xcr0 = ::_xgetbv(0);
+            const auto ymm = ((xcr0 & 0x06) == 0x06);
+            const auto zmm = ((xcr0 & 0xE6) == 0xE6);
+            this->f16c = ymm && f16c;
+
+            if (maxLeaf >= 7) {
+                ::__cpuidex(info, 7, 0);
+                this->avx2 = ymm && ((info[1] & (1 << 5)) != 0);
+                this->avx512f = zmm && ((info[1] & (1 << 16)) != 0);
+                this->avx512bw = this->avx512f
+                    && ((info[1] & (1 << 30)) != 0);
+            }
+        }
+
+#elif defined(DATRAW_X86_KERNELS)
+        __builtin_cpu_init();
+        this->avx2 = (__builtin_cpu_supports("avx2") != 0);
+        this->avx512f = (__builtin_cpu_supports("avx512f") != 0);
+        this->avx512bw = this->avx512f
+            && (__builtin_cpu_supports("avx512bw") != 0);
+        this->f16c = (__builtin_cpu_supports("f16c") != 0);
+        this->ssse3 = (__builtin_cpu_supports("ssse3") != 0);
+#endif /* (defined(DATRAW_X86_KERNELS) && defined(_MSC_VER)) */
+
+#if defined(DATRAW_NEON_KERNELS)
+        this->neon = true;
+#endif /* defined(DATRAW_NEON_KERNELS) */
+    }
+};
+
+DATRAW_DETAIL_NAMESPACE_END
+
+#endif /* !defined(_DATRAW_CPU_FEATURES_H) */
@@ -0,0 +1,73 @@
+﻿// <copyright file="default_init_allocator.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2026 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_DATRAW_DEFAULT_INIT_ALLOCATOR_H)
+#define _DATRAW_DEFAULT_INIT_ALLOCATOR_H
+#pragma once
+
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "datraw/abi.h"
+
+
+DATRAW_NAMESPACE_BEGIN
+
+/// <summary>
+/// An allocator adaptor which default-initialises instead of
+/// value-initialising elements that are constructed without arguments.
+/// </summary>
+/// <remarks>
+/// <para>Using this allocator for a <see cref="std::vector" /> of scalars
+/// prevents <c>resize</c> from zeroing memory that will be overwritten
+/// anyway, eg by the data of a time step.</para>
+/// </remarks>
+/// <typeparam name="T">The type of the elements to be allocated.</typeparam>
+/// <typeparam name="A">The allocator to be adapted.</typeparam>
+template<class T, class A = std::allocator<T>>
+class default_init_allocator : public A {
+
+    typedef std::allocator_traits<A> traits_type;
+
+public:
+
+    /// <summary>
+    /// Rebinds the allocator to another element type.
+    /// </summary>
+    template<class U> struct rebind {
+        typedef default_init_allocator<U,
+            typename traits_type::template rebind_alloc<U>> other;
+    };
+
+    using A::A;
+
+    /// <summary>
+    /// Default-initialises the object at <paramref name="ptr" />.
+    /// </summary>
+    /// <param name="ptr">The location of the object to be created.</param>
+    template<class U> inline void construct(U *ptr)
+            noexcept(std::is_nothrow_default_constructible<U>::value) {
+        ::new (static_cast<void *>(ptr)) U;
+    }
+
+    /// <summary>
+    /// Constructs the object at <paramref name="ptr" /> using the underlying
+    /// allocator.
+    /// </summary>
+    /// <param name="ptr">The location of the object to be created.</param>
+    /// <param name="params">The arguments for the constructor.</param>
+    template<class U, class... P> inline void construct(U *ptr,
+            P&&... params) {
+        traits_type::construct(static_cast<A&>(*this), ptr,
+            std::forward<P>(params)...);
+    }
+};
+
+DATRAW_NAMESPACE_END
+
+#endif /* !defined(_DATRAW_DEFAULT_INIT_ALLOCATOR_H) */
@@ -1,5 +1,5 @@
 ﻿// <copyright file="endianness.h" company="Visualisierungsinstitut der Universität Stuttgart">
-// Copyright © 2017 - 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Copyright © 2017 - 2026 Visualisierungsinstitut der Universität Stuttgart.
 // Licensed under the MIT licence. See LICENCE file for details.
 // </copyright>
 // <author>Christoph Müller</author>
@@ -34,7 +34,17 @@ enum class endianness : std::uint32_t {
     /// <summary>
     /// The native endian of the system the code is running on.
     /// </summary>
-    system = '\0\1\2\3'
+    /// <remarks>
+    /// Note that we cannot use a multi-character literal here, because the
+    /// compilers put the first character into the most significant byte
+    /// regardless of the byte order of the platform.
+    /// </remarks>
+#if (defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__))
+    system = big
+#else /* (defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)) */
+    // All platforms supported by Visual Studio are little endian.
+    system = little
+#endif /* (defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)) */
 };
 
 DATRAW_NAMESPACE_END
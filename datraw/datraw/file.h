@@ -0,0 +1,408 @@
+﻿// <copyright file="file.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2026 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_DATRAW_FILE_H)
+#define _DATRAW_FILE_H
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cerrno>
+#include <cinttypes>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#if defined(_WIN32)
+#include <Windows.h>
+#else /* defined(_WIN32) */
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#endif /* defined(_WIN32) */
+
+#include "datraw/abi.h"
+#include "datraw/access_pattern.h"
+#include "datraw/aligned_buffer.h"
+#include "datraw/string.h"
+
+
+DATRAW_DETAIL_NAMESPACE_BEGIN
+
+/// <summary>
+/// Identifies a specific version of a file on disk.
+/// </summary>
+/// <remarks>
+/// Two stamps of the same path are equal as long as the file has not been
+/// replaced or modified in between.
+/// </remarks>
+struct file_stamp final {
+
+    /// <summary>
+    /// The device holding the file, if available on the platform.
+    /// </summary>
+    std::uint64_t device;
+
+    /// <summary>
+    /// The index of the file on the device, if available on the platform.
+    /// </summary>
+    std::uint64_t index;
+
+    /// <summary>
+    /// The time of the last modification in platform-specific units.
+    /// </summary>
+    std::uint64_t modified;
+
+    /// <summary>
+    /// The size of the file in bytes.
+    /// </summary>
+    std::uint64_t size;
+
+    /// <summary>
+    /// Test for equality.
+    /// </summary>
+    /// <param name="rhs">The right-hand side operand.</param>
+    /// <returns><c>true</c> if this object and <paramref name="rhs" /> are
+    /// equal, <c>false</c> otherwise.</returns>
+    inline bool operator ==(const file_stamp& rhs) const noexcept {
+        return ((this->device == rhs.device)
+            && (this->index == rhs.index)
+            && (this->modified == rhs.modified)
+            && (this->size == rhs.size));
+    }
+
+    /// <summary>
+    /// Test for inequality.
+    /// </summary>
+    /// <param name="rhs">The right-hand side operand.</param>
+    /// <returns><c>true</c> if this object and <paramref name="rhs" /> are
+    /// not equal, <c>false</c> otherwise.</returns>
+    inline bool operator !=(const file_stamp& rhs) const noexcept {
+        return !(*this == rhs);
+    }
+};
+
+
+/// <summary>
+/// A thin RAII wrapper around a native, read-only file handle.
+/// </summary>
+/// <remarks>
+/// <para>In contrast to the standard streams, this class provides access to
+/// the native handle, which is required for mapping the raw files into
+/// memory.</para>
+/// </remarks>
+class file final {
+
+public:
+
+#if defined(_WIN32)
+    /// <summary>
+    /// The type of the native file handle.
+    /// </summary>
+    typedef HANDLE native_handle_type;
+#else /* defined(_WIN32) */
+    /// <summary>
+    /// The type of the native file handle.
+    /// </summary>
+    typedef int native_handle_type;
+#endif /* defined(_WIN32) */
+
+    /// <summary>
+    /// Answer the value of an invalid native handle.
+    /// </summary>
+    /// <returns>The value representing an invalid handle.</returns>
+    static inline native_handle_type invalid_handle(void) noexcept {
+#if defined(_WIN32)
+        return INVALID_HANDLE_VALUE;
+#else /* defined(_WIN32) */
+        return -1;
+#endif /* defined(_WIN32) */
+    }
+
+    /// <summary>
+    /// Opens the specified file for reading.
+    /// </summary>
+    /// <param name="path">The path to the file to be opened.</param>
+    /// <param name="direct">If <c>true</c>, the file is opened for direct
+    /// I/O, which bypasses the page cache of the operating system.</param>
+    /// <returns>The open file.</returns>
+    /// <exception cref="std::invalid_argument">If the file could not be
+    /// opened.</exception>
+    /// <exception cref="std::runtime_error">If direct I/O was requested, but
+    /// is not supported by the file system or the platform.</exception>
+    static inline file open(const std::string& path, const bool direct = false);
+
+    /// <summary>
+    /// Opens the specified file for reading.
+    /// </summary>
+    /// <param name="path">The path to the file to be opened.</param>
+    /// <param name="direct">If <c>true</c>, the file is opened for direct
+    /// I/O, which bypasses the page cache of the operating system.</param>
+    /// <returns>The open file.</returns>
+    /// <exception cref="std::invalid_argument">If the file could not be
+    /// opened.</exception>
+    /// <exception cref="std::runtime_error">If direct I/O was requested, but
+    /// is not supported by the file system or the platform.</exception>
+    static inline file open(const std::wstring& path, const bool direct = false);
+
+    /// <summary>
+    /// Retrieves the <see cref="file_stamp" /> of the specified file without
+    /// opening it.
+    /// </summary>
+    /// <param name="path">The path to the file.</param>
+    /// <param name="stamp">Receives the stamp of the file.</param>
+    /// <returns><c>true</c> if the stamp was retrieved, <c>false</c> if the
+    /// file does not exist or could not be accessed.</returns>
+    static inline bool stamp(const std::string& path,
+        file_stamp& stamp) noexcept;
+
+    /// <summary>
+    /// Retrieves the <see cref="file_stamp" /> of the specified file without
+    /// opening it.
+    /// </summary>
+    /// <param name="path">The path to the file.</param>
+    /// <param name="stamp">Receives the stamp of the file.</param>
+    /// <returns><c>true</c> if the stamp was retrieved, <c>false</c> if the
+    /// file does not exist or could not be accessed.</returns>
+    static inline bool stamp(const std::wstring& path,
+        file_stamp& stamp) noexcept;
+
+    /// <summary>
+    /// Initialises a new instance that does not represent a file.
+    /// </summary>
+    inline file(void) noexcept
+        : align(1), handle(file::invalid_handle()), isDirect(false) { }
+
+    file(const file&) = delete;
+
+    /// <summary>
+    /// Move <paramref name="rhs" /> into a new instance.
+    /// </summary>
+    /// <param name="rhs">The object to be moved.</param>
+    inline file(file&& rhs) noexcept : align(rhs.align),
+            handle(rhs.handle), isDirect(rhs.isDirect) {
+        rhs.align = 1;
+        rhs.handle = file::invalid_handle();
+        rhs.isDirect = false;
+    }
+
+    /// <summary>
+    /// Finalises the instance.
+    /// </summary>
+    inline ~file(void) noexcept {
+        this->close();
+    }
+
+    /// <summary>
+    /// Tells the operating system how the specified range of the file will
+    /// be accessed.
+    /// </summary>
+    /// <remarks>
+    /// The advice is only a hint, which is silently ignored if the platform
+    /// does not support it.
+    /// </remarks>
+    /// <param name="pattern">The expected access pattern.</param>
+    /// <param name="offset">The begin of the range in bytes.</param>
+    /// <param name="length">The length of the range in bytes.</param>
+    inline void advise(const access_pattern pattern,
+        const std::uint64_t offset, const std::uint64_t length) const noexcept;
+
+    /// <summary>
+    /// Answer the alignment of offsets, sizes and buffers for reading from
+    /// the file.
+    /// </summary>
+    /// <returns>The alignment in bytes, which is one unless the file has
+    /// been opened for direct I/O.</returns>
+    inline std::size_t alignment(void) const noexcept {
+        return this->align;
+    }
+
+    /// <summary>
+    /// Closes the file if it is open.
+    /// </summary>
+    inline void close(void) noexcept;
+
+    /// <summary>
+    /// Tells the operating system that the specified range of the file will
+    /// not be accessed in the near future, ie that its pages can be released
+    /// from the page cache.
+    /// </summary>
+    /// <remarks>
+    /// The advice is only a hint, which is silently ignored if the platform
+    /// does not support it.
+    /// </remarks>
+    /// <param name="offset">The begin of the range in bytes.</param>
+    /// <param name="length">The length of the range in bytes.</param>
+    inline void discard(const std::uint64_t offset,
+        const std::uint64_t length) const noexcept;
+
+    /// <summary>
+    /// Answer whether the file has been opened for direct I/O.
+    /// </summary>
+    /// <returns><c>true</c> if reads bypass the page cache, <c>false</c>
+    /// otherwise.</returns>
+    inline bool direct(void) const noexcept {
+        return this->isDirect;
+    }
+
+    /// <summary>
+    /// Answer the native handle of the file.
+    /// </summary>
+    /// <returns>The native handle, which remains owned by the object.
+    /// </returns>
+    inline native_handle_type native_handle(void) const noexcept {
+        return this->handle;
+    }
+
+    /// <summary>
+    /// Reads <paramref name="cnt" /> bytes starting at
+    /// <paramref name="offset" /> into <paramref name="dst" />.
+    /// </summary>
+    /// <remarks>
+    /// <para>The read is positional, ie it does not use or modify a file
+    /// pointer and can therefore be issued concurrently on the same file.
+    /// </para>
+    /// <para>If the file has been opened for direct I/O and the request is
+    /// not aligned to <see cref="alignment" />, the aligned superset of the
+    /// requested range is read into a temporary buffer and the requested
+    /// part is copied from there.</para>
+    /// </remarks>
+    /// <param name="offset">The offset in bytes from the begin of the file
+    /// where reading starts.</param>
+    /// <param name="dst">The buffer receiving the data, which must be able
+    /// to hold at least <paramref name="cnt" /> bytes.</param>
+    /// <param name="cnt">The number of bytes to read.</param>
+    /// <exception cref="std::runtime_error">If the requested range could
+    /// not be read completely.</exception>
+    inline void read(const std::uint64_t offset, void *dst,
+        const std::size_t cnt) const;
+
+    /// <summary>
+    /// Reads up to <paramref name="cnt" /> bytes starting at
+    /// <paramref name="offset" /> into <paramref name="dst" /> without any
+    /// adjustments for direct I/O.
+    /// </summary>
+    /// <remarks>
+    /// In contrast to <see cref="read" />, reaching the end of the file is
+    /// only an error if less than <paramref name="minimum" /> bytes have been
+    /// read. This allows for reading aligned windows of files whose size is
+    /// not aligned.
+    /// </remarks>
+    /// <param name="offset">The offset in bytes from the begin of the file
+    /// where reading starts.</param>
+    /// <param name="dst">The buffer receiving the data, which must be able
+    /// to hold at least <paramref name="cnt" /> bytes.</param>
+    /// <param name="cnt">The maximum number of bytes to read.</param>
+    /// <param name="minimum">The number of bytes that must be read.</param>
+    /// <returns>The number of bytes that have been read.</returns>
+    /// <exception cref="std::runtime_error">If less than
+    /// <paramref name="minimum" /> bytes could be read.</exception>
+    inline std::size_t read_some(const std::uint64_t offset, void *dst,
+        const std::size_t cnt, const std::size_t minimum) const;
+
+    /// <summary>
+    /// Answer the size of the file in bytes.
+    /// </summary>
+    /// <returns>The size of the file in bytes.</returns>
+    /// <exception cref="std::runtime_error">If the size could not be
+    /// retrieved.</exception>
+    inline std::uint64_t size(void) const;
+
+    /// <summary>
+    /// Answer the <see cref="file_stamp" /> of the open file.
+    /// </summary>
+    /// <returns>The stamp of the file.</returns>
+    /// <exception cref="std::runtime_error">If the information about the
+    /// file could not be retrieved.</exception>
+    inline file_stamp stamp(void) const;
+
+    file& operator =(const file&) = delete;
+
+    /// <summary>
+    /// Move assignment.
+    /// </summary>
+    /// <param name="rhs">The object to be moved.</param>
+    /// <returns><c>*this</c>.</returns>
+    inline file& operator =(file&& rhs) noexcept;
+
+    /// <summary>
+    /// Answer whether the object represents an open file.
+    /// </summary>
+    /// <returns><c>true</c> if the file is open, <c>false</c> otherwise.
+    /// </returns>
+    inline operator bool(void) const noexcept {
+        return (this->handle != file::invalid_handle());
+    }
+
+private:
+
+#if !defined(_WIN32)
+    /// <summary>
+    /// Converts the result of <c>stat</c> into a stamp.
+    /// </summary>
+    static inline file_stamp to_stamp(const struct stat& s) noexcept;
+#endif /* !defined(_WIN32) */
+
+    /// <summary>
+    /// The size of the blocks used for reading unaligned ranges from files
+    /// opened for direct I/O.
+    /// </summary>
+    static inline constexpr std::size_t direct_block_size(void) noexcept {
+        return 8 * 1024 * 1024;
+    }
+
+    /// <summary>
+    /// Throws the exception indicating that <paramref name="path" /> could
+    /// not be opened.
+    /// </summary>
+    template<class S> [[noreturn]] static void throw_open_failed(
+        const S& path);
+
+    /// <summary>
+    /// Throws the exception indicating that <paramref name="path" /> does
+    /// not support direct I/O.
+    /// </summary>
+    template<class S> [[noreturn]] static void throw_direct_unsupported(
+        const S& path);
+
+    /// <summary>
+    /// Determines the alignment required for direct I/O on the open file.
+    /// </summary>
+    inline std::size_t direct_alignment(void) const noexcept;
+
+    /// <summary>
+    /// Reads an unaligned range from a file opened for direct I/O via an
+    /// aligned temporary buffer.
+    /// </summary>
+    inline void read_unaligned(const std::uint64_t offset, void *dst,
+        const std::size_t cnt) const;
+
+    /// <summary>
+    /// The alignment required for reads.
+    /// </summary>
+    std::size_t align;
+
+    /// <summary>
+    /// The native handle of the file.
+    /// </summary>
+    native_handle_type handle;
+
+    /// <summary>
+    /// Remembers whether the file has been opened for direct I/O.
+    /// </summary>
+    bool isDirect;
+};
+
+DATRAW_DETAIL_NAMESPACE_END
+
+#include "datraw/file.inl"
+
+#endif /* !defined(_DATRAW_FILE_H) */
@@ -0,0 +1,495 @@
+﻿// <copyright file="file.inl" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2026 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+
+/*
+ * DATRAW_DETAIL_NAMESPACE::file::open
+ */
+DATRAW_DETAIL_NAMESPACE::file DATRAW_DETAIL_NAMESPACE::file::open(
+        const std::string& path, const bool direct) {
+    file retval;
+
+#if defined(_WIN32)
+    const DWORD flags = direct
+        ? (FILE_ATTRIBUTE_NORMAL | FILE_FLAG_NO_BUFFERING)
+        : FILE_ATTRIBUTE_NORMAL;
+    retval.handle = ::CreateFileA(path.c_str(), GENERIC_READ,
+        FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+        OPEN_EXISTING, flags, NULL);
+
+    if (!retval && direct
+            && (::GetLastError() == ERROR_INVALID_PARAMETER)) {
+        file::throw_direct_unsupported(path);
+    }
+
+#elif defined(O_DIRECT)
+    const auto flags = direct
+        ? (O_RDONLY | O_CLOEXEC | O_DIRECT)
+        : (O_RDONLY | O_CLOEXEC);
+    retval.handle = ::open(path.c_str(), flags);
+
+    if (!retval && direct && (errno == EINVAL)) {
+        file::throw_direct_unsupported(path);
+    }
+
+#else /* defined(_WIN32) */
+    retval.handle = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+
+#if defined(F_NOCACHE)
+    if (retval && direct && (::fcntl(retval.handle, F_NOCACHE, 1) == -1)) {
+        file::throw_direct_unsupported(path);
+    }
+#else /* defined(F_NOCACHE) */
+    if (direct) {
+        file::throw_direct_unsupported(path);
+    }
+#endif /* defined(F_NOCACHE) */
+#endif /* defined(_WIN32) */
+
+    if (!retval) {
+        file::throw_open_failed(path);
+    }
+
+    if (direct) {
+        retval.isDirect = true;
+        retval.align = retval.direct_alignment();
+    }
+
+    return retval;
+}
+
+
+/*
+ * DATRAW_DETAIL_NAMESPACE::file::open
+ */
+DATRAW_DETAIL_NAMESPACE::file DATRAW_DETAIL_NAMESPACE::file::open(
+        const std::wstring& path, const bool direct) {
+#if defined(_WIN32)
+    file retval;
+    const DWORD flags = direct
+        ? (FILE_ATTRIBUTE_NORMAL | FILE_FLAG_NO_BUFFERING)
+        : FILE_ATTRIBUTE_NORMAL;
+    retval.handle = ::CreateFileW(path.c_str(), GENERIC_READ,
+        FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+        OPEN_EXISTING, flags, NULL);
+
+    if (!retval && direct
+            && (::GetLastError() == ERROR_INVALID_PARAMETER)) {
+        file::throw_direct_unsupported(path);
+    }
+
+    if (!retval) {
+        file::throw_open_failed(path);
+    }
+
+    if (direct) {
+        retval.isDirect = true;
+        retval.align = retval.direct_alignment();
+    }
+
+    return retval;
+
+#else /* defined(_WIN32) */
+    // POSIX does not know wide paths, so we convert them to UTF-8.
+    return file::open(narrow_string(path), direct);
+#endif /* defined(_WIN32) */
+}
+
+
+/*
+ * DATRAW_DETAIL_NAMESPACE::file::stamp
+ */
+bool DATRAW_DETAIL_NAMESPACE::file::stamp(const std::string& path,
+        file_stamp& stamp) noexcept {
+#if defined(_WIN32)
+    WIN32_FILE_ATTRIBUTE_DATA data;
+    if (!::GetFileAttributesExA(path.c_str(), GetFileExInfoStandard, &data)) {
+        return false;
+    }
+
+    // The file index is only available for open files, so we do not use it
+    // in any stamp.
+    stamp.device = 0;
+    stamp.index = 0;
+    stamp.modified = (static_cast<std::uint64_t>(
+        data.ftLastWriteTime.dwHighDateTime) << 32)
+        | data.ftLastWriteTime.dwLowDateTime;
+    stamp.size = (static_cast<std::uint64_t>(data.nFileSizeHigh) << 32)
+        | data.nFileSizeLow;
+    return true;
+
+#else /* defined(_WIN32) */
+    struct stat s;
+    if (::stat(path.c_str(), &s) != 0) {
+        return false;
+    }
+
+    stamp = file::to_stamp(s);
+    return true;
+#endif /* defined(_WIN32) */
+}
+
+
+/*
+ * DATRAW_DETAIL_NAMESPACE::file::stamp
+ */
+bool DATRAW_DETAIL_NAMESPACE::file::stamp(const std::wstring& path,
+        file_stamp& stamp) noexcept {
+#if defined(_WIN32)
+    WIN32_FILE_ATTRIBUTE_DATA data;
+    if (!::GetFileAttributesExW(path.c_str(), GetFileExInfoStandard, &data)) {
+        return false;
+    }
+
+    stamp.device = 0;
+    stamp.index = 0;
+    stamp.modified = (static_cast<std::uint64_t>(
+        data.ftLastWriteTime.dwHighDateTime) << 32)
+        | data.ftLastWriteTime.dwLowDateTime;
+    stamp.size = (static_cast<std::uint64_t>(data.nFileSizeHigh) << 32)
+        | data.nFileSizeLow;
+    return true;
+
+#else /* defined(_WIN32) */
+    try {
+        return file::stamp(narrow_string(path), stamp);
+    } catch (...) {
+        return false;
+    }
+#endif /* defined(_WIN32) */
+}
+
+
+/*
+ * DATRAW_DETAIL_NAMESPACE::file::advise
+ */
+void DATRAW_DETAIL_NAMESPACE::file::advise(const access_pattern pattern,
+        const std::uint64_t offset,
+        const std::uint64_t length) const noexcept {
+#if defined(POSIX_FADV_NORMAL)
+    if (*this) {
+        auto advice = POSIX_FADV_NORMAL;
+        switch (pattern) {
+            case access_pattern::sequential:
+                advice = POSIX_FADV_SEQUENTIAL;
+                break;
+
+            case access_pattern::random:
+            case access_pattern::region:
+                advice = POSIX_FADV_RANDOM;
+                break;
+
+            default:
+                break;
+        }
+
+        ::posix_fadvise(this->handle, static_cast<off_t>(offset),
+            static_cast<off_t>(length), advice);
+    }
+#else /* defined(POSIX_FADV_NORMAL) */
+    // Windows only supports access hints when opening a file, which is
+    // unsuitable for handles that are shared between readers.
+    (void) pattern;
+    (void) offset;
+    (void) length;
+#endif /* defined(POSIX_FADV_NORMAL) */
+}
+
+
+/*
+ * DATRAW_DETAIL_NAMESPACE::file::close
+ */
+void DATRAW_DETAIL_NAMESPACE::file::close(void) noexcept {
+    if (*this) {
+#if defined(_WIN32)
+        ::CloseHandle(this->handle);
+#else /* defined(_WIN32) */
+        ::close(this->handle);
+#endif /* defined(_WIN32) */
+        this->handle = file::invalid_handle();
+    }
+}
+
+
+/*
+ * DATRAW_DETAIL_NAMESPACE::file::discard
+ */
+void DATRAW_DETAIL_NAMESPACE::file::discard(const std::uint64_t offset,
+        const std::uint64_t length) const noexcept {
+#if defined(POSIX_FADV_DONTNEED)
+    if (*this) {
+        ::posix_fadvise(this->handle, static_cast<off_t>(offset),
+            static_cast<off_t>(length), POSIX_FADV_DONTNEED);
+    }
+#else /* defined(POSIX_FADV_DONTNEED) */
+    (void) offset;
+    (void) length;
+#endif /* defined(POSIX_FADV_DONTNEED) */
+}
+
+
+/*
+ * DATRAW_DETAIL_NAMESPACE::file::read
+ */
+void DATRAW_DETAIL_NAMESPACE::file::read(const std::uint64_t offset,
+        void *dst, const std::size_t cnt) const {
+    if (cnt == 0) {
+        return;
+    }
+
+    const auto address = reinterpret_cast<std::uintptr_t>(dst);
+    if ((offset % this->align != 0) || (address % this->align != 0)
+            || (cnt % this->align != 0)) {
+        this->read_unaligned(offset, dst, cnt);
+    } else {
+        this->read_some(offset, dst, cnt, cnt);
+    }
+}
+
+
+/*
+ * DATRAW_DETAIL_NAMESPACE::file::read_some
+ */
+std::size_t DATRAW_DETAIL_NAMESPACE::file::read_some(
+        const std::uint64_t offset, void *dst, const std::size_t cnt,
+        const std::size_t minimum) const {
+    assert((dst != nullptr) || (cnt == 0));
+    assert(minimum <= cnt);
+    auto d = static_cast<char *>(dst);
+    auto o = offset;
+    auto r = cnt;
+
+    while (r > 0) {
+#if defined(_WIN32)
+        const auto chunk = static_cast<DWORD>((std::min)(r,
+            static_cast<std::size_t>(MAXDWORD)));
+        OVERLAPPED overlapped = { 0 };
+        overlapped.Offset = static_cast<DWORD>(o & 0xFFFFFFFF);
+        overlapped.OffsetHigh = static_cast<DWORD>(o >> 32);
+
+        DWORD read = 0;
+        if (!::ReadFile(this->handle, d, chunk, &read, &overlapped)) {
+            if (::GetLastError() != ERROR_HANDLE_EOF) {
+                throw std::runtime_error("Reading from the raw file "
+                    "failed.");
+            }
+        }
+
+#else /* defined(_WIN32) */
+        auto read = ::pread(this->handle, d, r, static_cast<off_t>(o));
+        if (read < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (this->isDirect && (errno == EINVAL)) {
+                throw std::runtime_error("The file system does not support "
+                    "direct I/O on the raw file.");
+            }
+            throw std::runtime_error("Reading from the raw file failed.");
+        }
+#endif /* defined(_WIN32) */
+
+        if (read == 0) {
+            break;
+        }
+
+        d += read;
+        o += read;
+        r -= static_cast<std::size_t>(read);
+    }
+
+    const auto retval = cnt - r;
+    if (retval < minimum) {
+        throw std::runtime_error("The raw file ended before all requested "
+            "data could be read.");
+    }
+
+    return retval;
+}
+
+
+/*
+ * DATRAW_DETAIL_NAMESPACE::file::size
+ */
+std::uint64_t DATRAW_DETAIL_NAMESPACE::file::size(void) const {
+#if defined(_WIN32)
+    LARGE_INTEGER retval;
+    if (!::GetFileSizeEx(this->handle, &retval)) {
+        throw std::runtime_error("The size of the raw file could not be "
+            "retrieved.");
+    }
+    return static_cast<std::uint64_t>(retval.QuadPart);
+
+#else /* defined(_WIN32) */
+    struct stat s;
+    if (::fstat(this->handle, &s) != 0) {
+        throw std::runtime_error("The size of the raw file could not be "
+            "retrieved.");
+    }
+    return static_cast<std::uint64_t>(s.st_size);
+#endif /* defined(_WIN32) */
+}
+
+
+/*
+ * DATRAW_DETAIL_NAMESPACE::file::stamp
+ */
+DATRAW_DETAIL_NAMESPACE::file_stamp DATRAW_DETAIL_NAMESPACE::file::stamp(
+        void) const {
+#if defined(_WIN32)
+    BY_HANDLE_FILE_INFORMATION info;
+    if (!::GetFileInformationByHandle(this->handle, &info)) {
+        throw std::runtime_error("The information about the raw file could "
+            "not be retrieved.");
+    }
+
+    // Cf. the path-based overload for why we do not use the file index.
+    file_stamp retval;
+    retval.device = 0;
+    retval.index = 0;
+    retval.modified = (static_cast<std::uint64_t>(
+        info.ftLastWriteTime.dwHighDateTime) << 32)
+        | info.ftLastWriteTime.dwLowDateTime;
+    retval.size = (static_cast<std::uint64_t>(info.nFileSizeHigh) << 32)
+        | info.nFileSizeLow;
+    return retval;
+
+#else /* defined(_WIN32) */
+    struct stat s;
+    if (::fstat(this->handle, &s) != 0) {
+        throw std::runtime_error("The information about the raw file could "
+            "not be retrieved.");
+    }
+
+    return file::to_stamp(s);
+#endif /* defined(_WIN32) */
+}
+
+
+/*
+ * DATRAW_DETAIL_NAMESPACE::file::operator =
+ */
+DATRAW_DETAIL_NAMESPACE::file& DATRAW_DETAIL_NAMESPACE::file::operator =(
+        file&& rhs) noexcept {
+    if (this != std::addressof(rhs)) {
+        this->close();
+        this->align = rhs.align;
+        this->handle = rhs.handle;
+        this->isDirect = rhs.isDirect;
+        rhs.align = 1;
+        rhs.handle = file::invalid_handle();
+        rhs.isDirect = false;
+    }
+
+    return *this;
+}
+
+
+/*
+ * DATRAW_DETAIL_NAMESPACE::file::direct_alignment
+ */
+std::size_t DATRAW_DETAIL_NAMESPACE::file::direct_alignment(
+        void) const noexcept {
+    // Four kilobytes satisfy the sector size of all common devices and the
+    // page size of most systems, so we use this unless we learn otherwise.
+    std::size_t retval = 4096;
+
+#if defined(_WIN32)
+    FILE_ALIGNMENT_INFO info;
+    if (::GetFileInformationByHandleEx(this->handle, FileAlignmentInfo,
+            &info, sizeof(info))) {
+        retval = (std::max)(retval,
+            static_cast<std::size_t>(info.AlignmentRequirement) + 1);
+    }
+
+#elif defined(STATX_DIOALIGN)
+    struct statx s;
+    if ((::statx(this->handle, "", AT_EMPTY_PATH, STATX_DIOALIGN, &s) == 0)
+            && ((s.stx_mask & STATX_DIOALIGN) != 0)) {
+        retval = (std::max)(retval, static_cast<std::size_t>(
+            (std::max)(s.stx_dio_mem_align, s.stx_dio_offset_align)));
+    }
+#endif /* defined(_WIN32) */
+
+    return retval;
+}
+
+
+/*
+ * DATRAW_DETAIL_NAMESPACE::file::read_unaligned
+ */
+void DATRAW_DETAIL_NAMESPACE::file::read_unaligned(
+        const std::uint64_t offset, void *dst, const std::size_t cnt) const {
+    assert(this->align > 0);
+    const auto begin = offset - offset % this->align;
+    const auto end = offset + cnt;
+    const auto blockSize = (std::max)(file::direct_block_size()
+        - file::direct_block_size() % this->align, this->align);
+    aligned_buffer buffer((std::min)(blockSize, static_cast<std::size_t>(
+        end - begin + this->align - 1) / this->align * this->align),
+        this->align);
+    auto d = static_cast<datraw::uint8 *>(dst);
+
+    for (auto b = begin; b < end; b += buffer.size()) {
+        // Determine the part of the aligned block we are interested in and
+        // read at least up to its end, but not more than the block.
+        const auto first = (std::max)(b, offset);
+        const auto last = (std::min)(b + buffer.size(), end);
+        const auto required = static_cast<std::size_t>(last - b);
+        this->read_some(b, buffer.data(), buffer.size(), required);
+        std::memcpy(d, buffer.data() + (first - b),
+            static_cast<std::size_t>(last - first));
+        d += last - first;
+    }
+}
+
+
+#if !defined(_WIN32)
+/*
+ * DATRAW_DETAIL_NAMESPACE::file::to_stamp
+ */
+DATRAW_DETAIL_NAMESPACE::file_stamp DATRAW_DETAIL_NAMESPACE::file::to_stamp(
+        const struct stat& s) noexcept {
+    file_stamp retval;
+    retval.device = static_cast<std::uint64_t>(s.st_dev);
+    retval.index = static_cast<std::uint64_t>(s.st_ino);
+#if defined(__APPLE__)
+    retval.modified = static_cast<std::uint64_t>(s.st_mtimespec.tv_sec)
+        * 1000000000 + s.st_mtimespec.tv_nsec;
+#elif defined(__linux__)
+    retval.modified = static_cast<std::uint64_t>(s.st_mtim.tv_sec)
+        * 1000000000 + s.st_mtim.tv_nsec;
+#else /* defined(__APPLE__) */
+    retval.modified = static_cast<std::uint64_t>(s.st_mtime) * 1000000000;
+#endif /* defined(__APPLE__) */
+    retval.size = static_cast<std::uint64_t>(s.st_size);
+    return retval;
+}
+#endif /* !defined(_WIN32) */
+
+
+/*
+ * DATRAW_DETAIL_NAMESPACE::file::throw_open_failed
+ */
+template<class S>
+void DATRAW_DETAIL_NAMESPACE::file::throw_open_failed(const S& path) {
+    std::stringstream msg;
+    msg << "The raw file \"" << narrow_string(path)
+        << "\" could not be opened." << std::ends;
+    throw std::invalid_argument(msg.str());
+}
+
+
+/*
+ * DATRAW_DETAIL_NAMESPACE::file::throw_direct_unsupported
+ */
+template<class S>
+void DATRAW_DETAIL_NAMESPACE::file::throw_direct_unsupported(const S& path) {
+    std::stringstream msg;
+    msg << "The file system holding the raw file \"" << narrow_string(path)
+        << "\" does not support direct I/O." << std::ends;
+    throw std::runtime_error(msg.str());
+}
@@ -0,0 +1,152 @@
+﻿// <copyright file="file_cache.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2026 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_DATRAW_FILE_CACHE_H)
+#define _DATRAW_FILE_CACHE_H
+#pragma once
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "datraw/file.h"
+
+
+DATRAW_DETAIL_NAMESPACE_BEGIN
+
+/// <summary>
+/// A small cache of open raw files and their sizes.
+/// </summary>
+/// <remarks>
+/// <para>Opening a file can be expensive, in particular on network file
+/// systems. The cache therefore keeps the most recently used files open and
+/// hands out shared handles to them. Before a cached handle is reused, the
+/// cache checks the <see cref="file_stamp" /> of the path, ie a file that has
+/// been replaced or modified is opened again.</para>
+/// <para>The cache is thread-safe.</para>
+/// </remarks>
+/// <typeparam name="C">The type of a character in a path.</typeparam>
+template<class C> class file_cache final {
+
+public:
+
+    /// <summary>
+    /// The type used to represent a single character in a string.
+    /// </summary>
+    typedef C char_type;
+
+    /// <summary>
+    /// The type of the handles handed out by the cache.
+    /// </summary>
+    typedef std::shared_ptr<const file> file_type;
+
+    /// <summary>
+    /// The type to express the capacity of the cache.
+    /// </summary>
+    typedef std::size_t size_type;
+
+    /// <summary>
+    /// The type used to represent a string.
+    /// </summary>
+    typedef std::basic_string<char_type> string_type;
+
+    /// <summary>
+    /// The number of files kept open if nothing else is specified.
+    /// </summary>
+    static const size_type default_capacity = 8;
+
+    /// <summary>
+    /// Initialises a new instance.
+    /// </summary>
+    /// <param name="capacity">The maximum number of files kept open. If
+    /// this is zero, every request opens the file.</param>
+    inline explicit file_cache(const size_type capacity = default_capacity)
+        : capacity(capacity) { }
+
+    file_cache(const file_cache&) = delete;
+
+    /// <summary>
+    /// Close all cached files.
+    /// </summary>
+    /// <remarks>
+    /// Handles that are still in use remain valid until they are released.
+    /// </remarks>
+    void clear(void);
+
+    /// <summary>
+    /// Answer the handle of the specified file if it is already open in the
+    /// cache.
+    /// </summary>
+    /// <remarks>
+    /// In contrast to <see cref="open" />, this method neither touches the
+    /// file system nor changes the order of the cache.
+    /// </remarks>
+    /// <param name="path">The path to the file.</param>
+    /// <param name="direct">If <c>true</c>, look for the handle opened for
+    /// direct I/O.</param>
+    /// <param name="size">Receives the size of the file in bytes if it is in
+    /// the cache.</param>
+    /// <returns>The cached file or <c>nullptr</c> if the file is not in the
+    /// cache.</returns>
+    file_type find(const string_type& path, const bool direct,
+        std::uint64_t& size);
+
+    /// <summary>
+    /// Answer a handle to the specified file, which is either retrieved from
+    /// the cache or newly opened.
+    /// </summary>
+    /// <param name="path">The path to the file.</param>
+    /// <param name="direct">If <c>true</c>, the file is opened for direct
+    /// I/O. Handles for buffered and direct I/O are cached independently.
+    /// </param>
+    /// <param name="size">Receives the size of the file in bytes.</param>
+    /// <returns>The open file.</returns>
+    /// <exception cref="std::invalid_argument">If the file could not be
+    /// opened.</exception>
+    /// <exception cref="std::runtime_error">If direct I/O is not supported
+    /// for the file.</exception>
+    file_type open(const string_type& path, const bool direct,
+        std::uint64_t& size);
+
+    file_cache& operator =(const file_cache&) = delete;
+
+private:
+
+    /// <summary>
+    /// A file in the cache.
+    /// </summary>
+    struct entry {
+        bool direct;
+        file_type file;
+        string_type path;
+        file_stamp stamp;
+    };
+
+    /// <summary>
+    /// The maximum number of entries.
+    /// </summary>
+    size_type capacity;
+
+    /// <summary>
+    /// The cached files with the most recently used one in front.
+    /// </summary>
+    std::vector<entry> entries;
+
+    /// <summary>
+    /// Protects <see cref="entries" />.
+    /// </summary>
+    std::mutex lock;
+};
+
+DATRAW_DETAIL_NAMESPACE_END
+
+#include "datraw/file_cache.inl"
+
+#endif /* !defined(_DATRAW_FILE_CACHE_H) */
@@ -0,0 +1,98 @@
+﻿// <copyright file="file_cache.inl" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2026 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+
+/*
+ * DATRAW_DETAIL_NAMESPACE::file_cache<C>::clear
+ */
+template<class C>
+void DATRAW_DETAIL_NAMESPACE::file_cache<C>::clear(void) {
+    std::lock_guard<std::mutex> l(this->lock);
+    this->entries.clear();
+}
+
+
+/*
+ * DATRAW_DETAIL_NAMESPACE::file_cache<C>::find
+ */
+template<class C>
+typename DATRAW_DETAIL_NAMESPACE::file_cache<C>::file_type
+DATRAW_DETAIL_NAMESPACE::file_cache<C>::find(const string_type& path,
+        const bool direct, std::uint64_t& size) {
+    std::lock_guard<std::mutex> l(this->lock);
+    auto it = std::find_if(this->entries.begin(), this->entries.end(),
+        [&path, direct](const entry& e) {
+            return ((e.path == path) && (e.direct == direct));
+        });
+
+    if (it == this->entries.end()) {
+        return nullptr;
+    }
+
+    size = it->stamp.size;
+    return it->file;
+}
+
+
+/*
+ * DATRAW_DETAIL_NAMESPACE::file_cache<C>::open
+ */
+template<class C>
+typename DATRAW_DETAIL_NAMESPACE::file_cache<C>::file_type
+DATRAW_DETAIL_NAMESPACE::file_cache<C>::open(const string_type& path,
+        const bool direct, std::uint64_t& size) {
+    file_stamp stamp;
+
+    if (file::stamp(path, stamp)) {
+        std::lock_guard<std::mutex> l(this->lock);
+        auto it = std::find_if(this->entries.begin(), this->entries.end(),
+            [&path, direct](const entry& e) {
+                return ((e.path == path) && (e.direct == direct));
+            });
+
+        if (it != this->entries.end()) {
+            if (it->stamp == stamp) {
+                // Cache hit, so move the entry to the front.
+                std::rotate(this->entries.begin(), it, it + 1);
+                size = this->entries.front().stamp.size;
+                return this->entries.front().file;
+            }
+
+            // The file has been changed since we opened it.
+            this->entries.erase(it);
+        }
+    }
+
+    // Open the file without holding the lock as this might take a while. If
+    // the file does not exist at all, this will throw the appropriate
+    // exception.
+    entry e;
+    e.direct = direct;
+    e.file = std::make_shared<file>(file::open(path, direct));
+    e.path = path;
+    e.stamp = e.file->stamp();
+    size = e.stamp.size;
+
+    if (this->capacity > 0) {
+        std::lock_guard<std::mutex> l(this->lock);
+        auto it = std::find_if(this->entries.begin(), this->entries.end(),
+            [&path, direct](const entry& e) {
+                return ((e.path == path) && (e.direct == direct));
+            });
+        if (it != this->entries.end()) {
+            // Someone else opened the file concurrently.
+            this->entries.erase(it);
+        }
+
+        this->entries.insert(this->entries.begin(), e);
+        if (this->entries.size() > this->capacity) {
+            this->entries.erase(this->entries.begin() + this->capacity,
+                this->entries.end());
+        }
+    }
+
+    return e.file;
+}
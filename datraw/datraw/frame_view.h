@@ -0,0 +1,239 @@
+﻿// <copyright file="frame_view.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2026 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_DATRAW_FRAME_VIEW_H)
+#define _DATRAW_FRAME_VIEW_H
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cinttypes>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+
+#include "datraw/access_pattern.h"
+#include "datraw/aligned_buffer.h"
+#include "datraw/convert.h"
+#include "datraw/file.h"
+#include "datraw/types.h"
+
+
+DATRAW_NAMESPACE_BEGIN
+
+/// <summary>
+/// A read-only view of the data of a single time step, which is backed by a
+/// memory mapping of the raw file or by an aligned buffer filled via direct
+/// I/O.
+/// </summary>
+/// <remarks>
+/// <para>The view owns the mapping and releases it once it is destroyed.
+/// Views can be moved, but not copied.</para>
+/// <para>If the data are stored in the byte order of the system, the view
+/// directly exposes the pages of the file and no copy is made. Otherwise,
+/// the file is mapped copy-on-write and the byte order is swapped in the
+/// private copy of the pages.</para>
+/// </remarks>
+class frame_view final {
+
+public:
+
+    /// <summary>
+    /// The type of an iterator over the bytes of the frame.
+    /// </summary>
+    typedef const datraw::uint8 *const_iterator;
+
+    /// <summary>
+    /// The type to express the size of the frame.
+    /// </summary>
+    typedef std::size_t size_type;
+
+    /// <summary>
+    /// Maps <paramref name="size" /> bytes starting at
+    /// <paramref name="offset" /> of <paramref name="file" /> into memory.
+    /// </summary>
+    /// <param name="file">The file to be mapped. The file may be closed
+    /// once the view has been created.</param>
+    /// <param name="offset">The offset of the first byte to be mapped, which
+    /// does not need to be aligned in any way.</param>
+    /// <param name="size">The number of bytes to be mapped.</param>
+    /// <param name="swapWidth">If this is a valid width for
+    /// <see cref="swap_byte_order" />, the file is mapped copy-on-write and
+    /// the byte order of the data is swapped. Otherwise, the data are
+    /// mapped as they are.</param>
+    /// <param name="pattern">The expected access pattern, which is passed
+    /// on to the virtual memory system if supported.</param>
+    /// <returns>A view of the requested range.</returns>
+    /// <exception cref="std::runtime_error">If the mapping failed.
+    /// </exception>
+    static inline frame_view map(const detail::file& file,
+        const std::uint64_t offset, const size_type size,
+        const size_type swapWidth = 0,
+        const access_pattern pattern = access_pattern::normal);
+
+    /// <summary>
+    /// Reads <paramref name="size" /> bytes starting at
+    /// <paramref name="offset" /> of <paramref name="file" /> into an
+    /// aligned buffer.
+    /// </summary>
+    /// <remarks>
+    /// The read covers the superset of the requested range that is aligned
+    /// to <see cref="detail::file::alignment" />, which allows for reading
+    /// the data of files opened for direct I/O without an additional copy.
+    /// <see cref="data" /> points to the requested range within the buffer.
+    /// </remarks>
+    /// <param name="file">The file to be read.</param>
+    /// <param name="offset">The offset of the first byte to be read, which
+    /// does not need to be aligned in any way.</param>
+    /// <param name="size">The number of bytes to be read.</param>
+    /// <param name="swapWidth">If this is a valid width for
+    /// <see cref="swap_byte_order" />, the byte order of the data is
+    /// swapped.</param>
+    /// <returns>A view of the requested range.</returns>
+    /// <exception cref="std::runtime_error">If the data could not be read.
+    /// </exception>
+    static inline frame_view read(const detail::file& file,
+        const std::uint64_t offset, const size_type size,
+        const size_type swapWidth = 0);
+
+    /// <summary>
+    /// Initialises a new, empty instance.
+    /// </summary>
+    inline frame_view(void) noexcept
+        : base(nullptr), extent(0), first(nullptr), length(0) { }
+
+    frame_view(const frame_view&) = delete;
+
+    /// <summary>
+    /// Move <paramref name="rhs" /> into a new instance.
+    /// </summary>
+    /// <param name="rhs">The object to be moved.</param>
+    inline frame_view(frame_view&& rhs) noexcept
+            : base(rhs.base), buffer(std::move(rhs.buffer)),
+            extent(rhs.extent), first(rhs.first), length(rhs.length) {
+        rhs.base = nullptr;
+        rhs.extent = 0;
+        rhs.first = nullptr;
+        rhs.length = 0;
+    }
+
+    /// <summary>
+    /// Finalises the instance.
+    /// </summary>
+    inline ~frame_view(void) noexcept {
+        this->unmap();
+    }
+
+    /// <summary>
+    /// Answer an iterator to the first byte of the frame.
+    /// </summary>
+    /// <returns>An iterator to the begin of the frame.</returns>
+    inline const_iterator begin(void) const noexcept {
+        return this->first;
+    }
+
+    /// <summary>
+    /// Answer a pointer to the first byte of the frame.
+    /// </summary>
+    /// <remarks>
+    /// The pointer has already been adjusted for the data offset of the raw
+    /// file. It is only aligned to the natural alignment of the scalars if
+    /// the data offset is a multiple of the scalar size.
+    /// </remarks>
+    /// <returns>A pointer to the data, which might be <c>nullptr</c> if the
+    /// view is empty.</returns>
+    inline const void *data(void) const noexcept {
+        return this->first;
+    }
+
+    /// <summary>
+    /// Answer whether the view does not contain any data.
+    /// </summary>
+    /// <returns><c>true</c> if the view is empty, <c>false</c> otherwise.
+    /// </returns>
+    inline bool empty(void) const noexcept {
+        return (this->length == 0);
+    }
+
+    /// <summary>
+    /// Answer an iterator past the last byte of the frame.
+    /// </summary>
+    /// <returns>An iterator to the end of the frame.</returns>
+    inline const_iterator end(void) const noexcept {
+        return this->first + this->length;
+    }
+
+    /// <summary>
+    /// Answer the size of the frame in bytes.
+    /// </summary>
+    /// <returns>The size of the frame.</returns>
+    inline size_type size(void) const noexcept {
+        return this->length;
+    }
+
+    frame_view& operator =(const frame_view&) = delete;
+
+    /// <summary>
+    /// Move assignment.
+    /// </summary>
+    /// <param name="rhs">The object to be moved.</param>
+    /// <returns><c>*this</c>.</returns>
+    inline frame_view& operator =(frame_view&& rhs) noexcept;
+
+    /// <summary>
+    /// Answer whether the view contains any data.
+    /// </summary>
+    /// <returns><c>true</c> if the view is not empty, <c>false</c>
+    /// otherwise.</returns>
+    inline operator bool(void) const noexcept {
+        return !this->empty();
+    }
+
+private:
+
+    /// <summary>
+    /// Answer the granularity in which the offset of a mapping must be
+    /// specified.
+    /// </summary>
+    static inline std::uint64_t granularity(void) noexcept;
+
+    /// <summary>
+    /// Releases the mapping or the buffer, if any.
+    /// </summary>
+    inline void unmap(void) noexcept;
+
+    /// <summary>
+    /// The begin of the mapping, which is aligned to
+    /// <see cref="granularity" />.
+    /// </summary>
+    void *base;
+
+    /// <summary>
+    /// The buffer holding the data if the view is not backed by a mapping.
+    /// </summary>
+    detail::aligned_buffer buffer;
+
+    /// <summary>
+    /// The size of the mapping starting at <see cref="base" />.
+    /// </summary>
+    size_type extent;
+
+    /// <summary>
+    /// The first byte of the frame.
+    /// </summary>
+    const datraw::uint8 *first;
+
+    /// <summary>
+    /// The size of the frame starting at <see cref="first" />.
+    /// </summary>
+    size_type length;
+};
+
+DATRAW_NAMESPACE_END
+
+#include "datraw/frame_view.inl"
+
+#endif /* !defined(_DATRAW_FRAME_VIEW_H) */
@@ -0,0 +1,190 @@
+﻿// <copyright file="frame_view.inl" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2026 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+
+/*
+ * DATRAW_NAMESPACE::frame_view::map
+ */
+DATRAW_NAMESPACE::frame_view DATRAW_NAMESPACE::frame_view::map(
+        const detail::file& file, const std::uint64_t offset,
+        const size_type size, const size_type swapWidth,
+        const access_pattern pattern) {
+    frame_view retval;
+
+    if (size == 0) {
+        // Empty mappings are not supported by the OS, but an empty view is
+        // what the caller asked for anyway.
+        return retval;
+    }
+
+    const auto swap = ((swapWidth == 2) || (swapWidth == 4)
+        || (swapWidth == 8));
+    const auto begin = offset - (offset % frame_view::granularity());
+    const auto adjust = static_cast<size_type>(offset - begin);
+    retval.extent = size + adjust;
+
+#if defined(_WIN32)
+    auto mapping = ::CreateFileMapping(file.native_handle(), nullptr,
+        swap ? PAGE_WRITECOPY : PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == NULL) {
+        throw std::runtime_error("The raw file could not be mapped.");
+    }
+
+    retval.base = ::MapViewOfFile(mapping,
+        swap ? FILE_MAP_COPY : FILE_MAP_READ,
+        static_cast<DWORD>(begin >> 32),
+        static_cast<DWORD>(begin & 0xFFFFFFFF),
+        retval.extent);
+    ::CloseHandle(mapping);
+
+    if (retval.base == nullptr) {
+        retval.extent = 0;
+        throw std::runtime_error("The raw file could not be mapped.");
+    }
+
+    // There is no equivalent of madvise for views of files on Windows.
+    (void) pattern;
+
+#else /* defined(_WIN32) */
+    retval.base = ::mmap(nullptr, retval.extent,
+        swap ? (PROT_READ | PROT_WRITE) : PROT_READ,
+        swap ? MAP_PRIVATE : MAP_SHARED,
+        file.native_handle(), static_cast<off_t>(begin));
+
+    if (retval.base == MAP_FAILED) {
+        retval.base = nullptr;
+        retval.extent = 0;
+        throw std::runtime_error("The raw file could not be mapped.");
+    }
+
+    switch (pattern) {
+        case access_pattern::sequential:
+            ::madvise(retval.base, retval.extent, MADV_SEQUENTIAL);
+            break;
+
+        case access_pattern::random:
+        case access_pattern::region:
+            ::madvise(retval.base, retval.extent, MADV_RANDOM);
+            break;
+
+        default:
+            break;
+    }
+#endif /* defined(_WIN32) */
+
+    auto data = static_cast<datraw::uint8 *>(retval.base) + adjust;
+    retval.first = data;
+    retval.length = size;
+
+    if (swap) {
+        // The pages are private to us at this point, so we can safely change
+        // the data and write-protect them afterwards.
+        assert(size % swapWidth == 0);
+        swap_byte_order(swapWidth, data, size / swapWidth);
+
+#if defined(_WIN32)
+        DWORD oldProtect;
+        ::VirtualProtect(retval.base, retval.extent, PAGE_READONLY,
+            &oldProtect);
+#else /* defined(_WIN32) */
+        ::mprotect(retval.base, retval.extent, PROT_READ);
+#endif /* defined(_WIN32) */
+    }
+
+    return retval;
+}
+
+
+/*
+ * DATRAW_NAMESPACE::frame_view::read
+ */
+DATRAW_NAMESPACE::frame_view DATRAW_NAMESPACE::frame_view::read(
+        const detail::file& file, const std::uint64_t offset,
+        const size_type size, const size_type swapWidth) {
+    frame_view retval;
+
+    if (size == 0) {
+        return retval;
+    }
+
+    const auto alignment = (std::max)(file.alignment(), sizeof(void *));
+    const auto begin = offset - (offset % alignment);
+    const auto adjust = static_cast<size_type>(offset - begin);
+    const auto extent = (adjust + size + alignment - 1) / alignment
+        * alignment;
+
+    // Read the aligned window, which may extend beyond the end of the file,
+    // in which case only the requested part must have been read.
+    retval.buffer = detail::aligned_buffer(extent, alignment);
+    file.read_some(begin, retval.buffer.data(), extent, adjust + size);
+
+    auto data = retval.buffer.data() + adjust;
+    retval.first = data;
+    retval.length = size;
+
+    if ((swapWidth == 2) || (swapWidth == 4) || (swapWidth == 8)) {
+        assert(size % swapWidth == 0);
+        swap_byte_order(swapWidth, data, size / swapWidth);
+    }
+
+    return retval;
+}
+
+
+/*
+ * DATRAW_NAMESPACE::frame_view::operator =
+ */
+DATRAW_NAMESPACE::frame_view& DATRAW_NAMESPACE::frame_view::operator =(
+        frame_view&& rhs) noexcept {
+    if (this != std::addressof(rhs)) {
+        this->unmap();
+        this->base = rhs.base;
+        this->buffer = std::move(rhs.buffer);
+        this->extent = rhs.extent;
+        this->first = rhs.first;
+        this->length = rhs.length;
+        rhs.base = nullptr;
+        rhs.extent = 0;
+        rhs.first = nullptr;
+        rhs.length = 0;
+    }
+
+    return *this;
+}
+
+
+/*
+ * DATRAW_NAMESPACE::frame_view::granularity
+ */
+std::uint64_t DATRAW_NAMESPACE::frame_view::granularity(void) noexcept {
+#if defined(_WIN32)
+    SYSTEM_INFO info;
+    ::GetSystemInfo(&info);
+    return info.dwAllocationGranularity;
+#else /* defined(_WIN32) */
+    return static_cast<std::uint64_t>(::sysconf(_SC_PAGESIZE));
+#endif /* defined(_WIN32) */
+}
+
+
+/*
+ * DATRAW_NAMESPACE::frame_view::unmap
+ */
+void DATRAW_NAMESPACE::frame_view::unmap(void) noexcept {
+    if (this->base != nullptr) {
+#if defined(_WIN32)
+        ::UnmapViewOfFile(this->base);
+#else /* defined(_WIN32) */
+        ::munmap(this->base, this->extent);
+#endif /* defined(_WIN32) */
+        this->base = nullptr;
+        this->extent = 0;
+    }
+
+    this->buffer.release();
+    this->first = nullptr;
+    this->length = 0;
+}
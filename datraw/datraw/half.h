@@ -11,6 +11,7 @@
 #include <cassert>
 #include <cinttypes>
 #include <cmath>
+#include <cstddef>
 #include <cstring>
 #include <cstdint>
 #include <limits>
@@ -21,6 +22,7 @@
 #endif /* defined(_MSC_VER) */
 
 #include "datraw/abi.h"
+#include "datraw/cpu_features.h"
 
 
 DATRAW_DETAIL_NAMESPACE_BEGIN
@@ -179,6 +181,158 @@ template<> struct half_converter<false, true> final {
 };
 #endif /* (defined(_M_ARM) || defined(_M_ARM64) || defined(__aarch64__)) */
 
+
+#if defined(DATRAW_X86_KERNELS)
+/// <summary>
+/// Widens all complete blocks of eight half-precision numbers using F16C.
+/// </summary>
+/// <returns>The number of elements that have been processed.</returns>
+DATRAW_TARGET("avx,f16c")
+inline std::size_t half_to_float_f16c(const std::uint16_t *src, float *dst,
+        const std::size_t cnt) noexcept {
+    const auto size = cnt & ~std::size_t(7);
+    for (std::size_t i = 0; i < size; i += 8) {
+        const auto h = _mm_loadu_si128(
+            reinterpret_cast<const __m128i *>(src + i));
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(h));
+    }
+    return size;
+}
+
+
+/// <summary>
+/// Narrows all complete blocks of eight single-precision numbers using
+/// F16C.
+/// </summary>
+/// <returns>The number of elements that have been processed.</returns>
+DATRAW_TARGET("avx,f16c")
+inline std::size_t float_to_half_f16c(const float *src, std::uint16_t *dst,
+        const std::size_t cnt) noexcept {
+    const auto size = cnt & ~std::size_t(7);
+    for (std::size_t i = 0; i < size; i += 8) {
+        const auto h = _mm256_cvtps_ph(_mm256_loadu_ps(src + i),
+            _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), h);
+    }
+    return size;
+}
+
+
+/// <summary>
+/// Widens all complete blocks of 16 half-precision numbers using AVX-512.
+/// </summary>
+/// <returns>The number of elements that have been processed.</returns>
+DATRAW_TARGET("avx512f")
+inline std::size_t half_to_float_avx512(const std::uint16_t *src,
+        float *dst, const std::size_t cnt) noexcept {
+    // The zero-masking variant with all lanes enabled is equivalent to the
+    // unmasked one, but does not cause GCC to warn about its pass-through
+    // operand being uninitialised.
+    const auto all = static_cast<__mmask16>(0xFFFF);
+    const auto size = cnt & ~std::size_t(15);
+    for (std::size_t i = 0; i < size; i += 16) {
+        const auto h = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i *>(src + i));
+        _mm512_storeu_ps(dst + i, _mm512_maskz_cvtph_ps(all, h));
+    }
+    return size;
+}
+
+
+/// <summary>
+/// Narrows all complete blocks of 16 single-precision numbers using
+/// AVX-512.
+/// </summary>
+/// <returns>The number of elements that have been processed.</returns>
+DATRAW_TARGET("avx512f")
+inline std::size_t float_to_half_avx512(const float *src,
+        std::uint16_t *dst, const std::size_t cnt) noexcept {
+    const auto all = static_cast<__mmask16>(0xFFFF);
+    const auto size = cnt & ~std::size_t(15);
+    for (std::size_t i = 0; i < size; i += 16) {
+        const auto h = _mm512_maskz_cvtps_ph(all, _mm512_loadu_ps(src + i),
+            _MM_FROUND_TO_NEAREST_INT);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), h);
+    }
+    return size;
+}
+#endif /* defined(DATRAW_X86_KERNELS) */
+
+
+#if defined(DATRAW_NEON_KERNELS)
+/// <summary>
+/// Widens all complete blocks of four half-precision numbers using NEON.
+/// </summary>
+/// <returns>The number of elements that have been processed.</returns>
+inline std::size_t half_to_float_neon(const std::uint16_t *src, float *dst,
+        const std::size_t cnt) noexcept {
+    const auto size = cnt & ~std::size_t(3);
+    for (std::size_t i = 0; i < size; i += 4) {
+        vst1q_f32(dst + i, vcvt_f32_f16(vreinterpret_f16_u16(
+            vld1_u16(src + i))));
+    }
+    return size;
+}
+
+
+/// <summary>
+/// Narrows all complete blocks of four single-precision numbers using
+/// NEON.
+/// </summary>
+/// <returns>The number of elements that have been processed.</returns>
+inline std::size_t float_to_half_neon(const float *src, std::uint16_t *dst,
+        const std::size_t cnt) noexcept {
+    const auto size = cnt & ~std::size_t(3);
+    for (std::size_t i = 0; i < size; i += 4) {
+        vst1_u16(dst + i, vreinterpret_u16_f16(vcvt_f16_f32(
+            vld1q_f32(src + i))));
+    }
+    return size;
+}
+#endif /* defined(DATRAW_NEON_KERNELS) */
+
+
+/// <summary>
+/// Widens as many of the <paramref name="cnt" /> half-precision numbers as
+/// possible using the best instructions the CPU supports.
+/// </summary>
+/// <returns>The number of elements that have been processed.</returns>
+inline std::size_t half_to_float_vectorised(const std::uint16_t *src,
+        float *dst, const std::size_t cnt) {
+#if defined(DATRAW_X86_KERNELS)
+    const auto& cpu = cpu_features::instance();
+    if (cpu.avx512f) {
+        return half_to_float_avx512(src, dst, cnt);
+    } else if (cpu.f16c) {
+        return half_to_float_f16c(src, dst, cnt);
+    }
+#elif defined(DATRAW_NEON_KERNELS)
+    return half_to_float_neon(src, dst, cnt);
+#endif /* defined(DATRAW_X86_KERNELS) */
+    return 0;
+}
+
+
+/// <summary>
+/// Narrows as many of the <paramref name="cnt" /> single-precision numbers
+/// as possible using the best instructions the CPU supports.
+/// </summary>
+/// <returns>The number of elements that have been processed.</returns>
+inline std::size_t float_to_half_vectorised(const float *src,
+        std::uint16_t *dst, const std::size_t cnt) {
+#if defined(DATRAW_X86_KERNELS)
+    const auto& cpu = cpu_features::instance();
+    if (cpu.avx512f) {
+        return float_to_half_avx512(src, dst, cnt);
+    } else if (cpu.f16c) {
+        return float_to_half_f16c(src, dst, cnt);
+    }
+#elif defined(DATRAW_NEON_KERNELS)
+    return float_to_half_neon(src, dst, cnt);
+#endif /* defined(DATRAW_X86_KERNELS) */
+    return 0;
+}
+
 DATRAW_DETAIL_NAMESPACE_END
 
 
@@ -262,6 +416,56 @@ private:
 typedef basic_half<false> half;
 static_assert(sizeof(half) == 2, "The size of half must be 2 bytes.");
 
+
+/// <summary>
+/// Converts <paramref name="cnt" /> half-precision numbers to single
+/// precision.
+/// </summary>
+/// <remarks>
+/// The bulk of the data is converted using F16C or AVX-512 on x86 and NEON
+/// on ARM if the CPU supports it. The results are the same as for the
+/// conversion of single values, except for the payload of NaNs.
+/// </remarks>
+/// <param name="src">The numbers to be converted.</param>
+/// <param name="dst">Receives <paramref name="cnt" /> converted numbers.
+/// </param>
+/// <param name="cnt">The number of elements to convert.</param>
+inline void half_to_float(const half *src, float *dst,
+        const std::size_t cnt) {
+    assert((src != nullptr) || (cnt == 0));
+    assert((dst != nullptr) || (cnt == 0));
+    auto s = reinterpret_cast<const std::uint16_t *>(src);
+    for (auto i = detail::half_to_float_vectorised(s, dst, cnt); i < cnt;
+            ++i) {
+        dst[i] = static_cast<float>(src[i]);
+    }
+}
+
+
+/// <summary>
+/// Converts <paramref name="cnt" /> single-precision numbers to half
+/// precision, rounding to the nearest representable value.
+/// </summary>
+/// <remarks>
+/// The bulk of the data is converted using F16C or AVX-512 on x86 and NEON
+/// on ARM if the CPU supports it. The results are the same as for the
+/// conversion of single values, except for the payload of NaNs.
+/// </remarks>
+/// <param name="src">The numbers to be converted.</param>
+/// <param name="dst">Receives <paramref name="cnt" /> converted numbers.
+/// </param>
+/// <param name="cnt">The number of elements to convert.</param>
+inline void float_to_half(const float *src, half *dst,
+        const std::size_t cnt) {
+    assert((src != nullptr) || (cnt == 0));
+    assert((dst != nullptr) || (cnt == 0));
+    auto d = reinterpret_cast<std::uint16_t *>(dst);
+    for (auto i = detail::float_to_half_vectorised(src, d, cnt); i < cnt;
+            ++i) {
+        dst[i] = half(src[i]);
+    }
+}
+
 DATRAW_NAMESPACE_END
 
 
@@ -285,6 +489,7 @@ public:
     static constexpr bool is_iec559 = true;
     static constexpr bool is_modulo = false;
     static constexpr bool is_signed = true;
+    static constexpr bool is_specialized = true;
     static constexpr int max_digits10 = 5;
     static constexpr int max_exponent = 16;
     static constexpr int max_exponent10 = 4;
@@ -293,17 +498,33 @@ public:
     static constexpr int radix = 2;
     static constexpr float_round_style round_style = std::round_indeterminate;
 
-    //static constexpr _type min() noexcept { return 0x0400; }
-    //static constexpr _type lowest() noexcept { return 0xFBFF; }
-    //static constexpr _type max() noexcept { return 0x7BFF; }
-    //static constexpr _type epsilon() noexcept { return 0x1400; }
-    //static constexpr _type round_error() noexcept {
-    //    return (round_style == std::round_to_nearest) ? 0x3800 : 0x3C00;
-    //}
-    //static constexpr _type infinity() noexcept { return 0x7C00; }
-    //static constexpr _type quiet_NaN() noexcept { return 0x7FFF; }
-    //static constexpr _type signaling_NaN() noexcept { return 0x7DFF; }
-    //static constexpr _type denorm_min() noexcept { return 0x0001; }
+    static constexpr _type (min)(void) noexcept {
+        return _type::from_bits(0x0400);
+    }
+    static constexpr _type lowest(void) noexcept {
+        return _type::from_bits(0xFBFF);
+    }
+    static constexpr _type (max)(void) noexcept {
+        return _type::from_bits(0x7BFF);
+    }
+    static constexpr _type epsilon(void) noexcept {
+        return _type::from_bits(0x1400);
+    }
+    static constexpr _type round_error(void) noexcept {
+        return _type::from_bits(0x3C00);
+    }
+    static constexpr _type infinity(void) noexcept {
+        return _type::from_bits(0x7C00);
+    }
+    static constexpr _type quiet_NaN(void) noexcept {
+        return _type::from_bits(0x7FFF);
+    }
+    static constexpr _type signaling_NaN(void) noexcept {
+        return _type::from_bits(0x7DFF);
+    }
+    static constexpr _type denorm_min(void) noexcept {
+        return _type::from_bits(0x0001);
+    }
 };
 
 #endif /* !defined(_DATRAW_HALF_H) */
@@ -1,5 +1,5 @@
 ﻿// <copyright file="info.h" company="Visualisierungsinstitut der Universität Stuttgart">
-// Copyright © 2017 - 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Copyright © 2017 - 2026 Visualisierungsinstitut der Universität Stuttgart.
 // Licensed under the MIT licence. See LICENCE file for details.
 // </copyright>
 // <author>Christoph Müller</author>
@@ -365,6 +365,21 @@ public:
         return v.template get<datraw::scalar_type>();
     }
 
+    /// <summary>
+    /// Answer the size of a single time step in bytes as it follows from the
+    /// resolution and the size of an element.
+    /// </summary>
+    /// <remarks>
+    /// <para>This method can only be called if the grid is organised in rows
+    /// like for Cartesian and rectilinear ones. It does not access the raw
+    /// file, ie the raw file might actually be larger, eg if it contains
+    /// additional data after the volume.</para>
+    /// </remarks>
+    /// <returns>The size of a frame in bytes.</returns>
+    /// <exception cref="std::runtime_error">If the grid is not organised in
+    /// rows or if the size of an element is unknown.</exception>
+    std::size_t frame_size(void) const;
+
     /// <summary>
     /// Gets the value of the well-known property named
     /// <see cref="property_grid_type" />.
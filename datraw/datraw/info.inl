@@ -1,5 +1,5 @@
 ﻿// <copyright file="info.inl" company="Visualisierungsinstitut der Universität Stuttgart">
-// Copyright © 2017 - 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Copyright © 2017 - 2026 Visualisierungsinstitut der Universität Stuttgart.
 // Licensed under the MIT licence. See LICENCE file for details.
 // </copyright>
 // <author>Christoph Müller</author>
@@ -575,6 +575,26 @@ typename DATRAW_NAMESPACE::info<C>::string_type DATRAW_NAMESPACE::info<C>::evalu
 }
 
 
+/*
+ * DATRAW_NAMESPACE::info<C>::frame_size
+ */
+template<class C>
+std::size_t DATRAW_NAMESPACE::info<C>::frame_size(void) const {
+    auto retval = this->row_size();
+    if (this->element_size() == 0) {
+        throw std::runtime_error("The size of a frame can only be computed "
+            "if the size of an element is known.");
+    }
+
+    auto resolution = this->resolution();
+    for (std::size_t i = 1; i < resolution.size(); ++i) {
+        retval *= resolution[i];
+    }
+
+    return retval;
+}
+
+
 /*
  * DATRAW_NAMESPACE::info<C>::multi_file_name
  */
@@ -612,11 +632,8 @@ std::size_t DATRAW_NAMESPACE::info<C>::row_pitch(const std::size_t alignment) co
     auto retval = this->row_size();
 
     if (alignment > 0) {
-        if (retval < alignment) {
-            retval = alignment;
-        } else {
-            retval += (retval % alignment);
-        }
+        // Round up to the next multiple of the alignment.
+        retval = ((retval + alignment - 1) / alignment) * alignment;
     }
 
     return retval;
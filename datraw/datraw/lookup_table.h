@@ -0,0 +1,184 @@
+﻿// <copyright file="lookup_table.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2026 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_DATRAW_LOOKUP_TABLE_H)
+#define _DATRAW_LOOKUP_TABLE_H
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include "datraw/convert.h"
+#include "datraw/types.h"
+
+
+DATRAW_NAMESPACE_BEGIN
+
+/// <summary>
+/// A table holding the converted value of every possible 8-bit or 16-bit
+/// scalar, which turns the conversion of large amounts of data into a
+/// simple lookup.
+/// </summary>
+/// <remarks>
+/// <para>The table for the standard conversion rules of
+/// <see cref="convert" /> is created once per pair of types on first use of
+/// <see cref="standard" />. <see cref="convert" /> uses this table
+/// automatically for large ranges of 8-bit and 16-bit integers.</para>
+/// <para>Custom tables, eg for applying a window/level transfer function to
+/// CT data, can be created using <see cref="make" /> and reused for as many
+/// frames as necessary.</para>
+/// </remarks>
+/// <typeparam name="S">The source type, which must be an integral type
+/// with at most 16 bits.</typeparam>
+/// <typeparam name="T">The target type.</typeparam>
+template<class S, class T> class lookup_table final {
+    static_assert(std::is_integral<S>::value && (sizeof(S) <= 2),
+        "Lookup tables can only be created for integral types with at most "
+        "16 bits.");
+
+public:
+
+    /// <summary>
+    /// The type to express sizes.
+    /// </summary>
+    typedef std::size_t size_type;
+
+    /// <summary>
+    /// The type of the input values.
+    /// </summary>
+    typedef S source_type;
+
+    /// <summary>
+    /// The type of the converted values.
+    /// </summary>
+    typedef T value_type;
+
+    /// <summary>
+    /// Answer the number of entries in the table, which is the number of
+    /// values <typeparamref name="S" /> can represent.
+    /// </summary>
+    /// <returns>The number of entries in the table.</returns>
+    static inline constexpr size_type entries(void) noexcept {
+        return size_type(1) << (8 * sizeof(source_type));
+    }
+
+    /// <summary>
+    /// Creates a custom table by evaluating <paramref name="func" /> for
+    /// every possible input value.
+    /// </summary>
+    /// <typeparam name="F">The type of the function, which must accept a
+    /// <typeparamref name="S" /> and return something convertible to
+    /// <typeparamref name="T" />.</typeparam>
+    /// <param name="func">The function computing the converted value.
+    /// </param>
+    /// <returns>The new table.</returns>
+    template<class F> static lookup_table make(F&& func);
+
+    /// <summary>
+    /// Answer the table implementing the standard conversion rules of
+    /// <see cref="convert" />, which is created on first use.
+    /// </summary>
+    /// <returns>The shared table of the standard conversion.</returns>
+    static inline const lookup_table& standard(void) {
+        static const lookup_table retval;
+        return retval;
+    }
+
+    /// <summary>
+    /// Initialises a new instance with the standard conversion rules of
+    /// <see cref="convert" />.
+    /// </summary>
+    lookup_table(void);
+
+    /// <summary>
+    /// Convert the range designated by <paramref name="begin" /> and
+    /// <paramref name="end" /> using the table and write the result to
+    /// <paramref name="dst" />.
+    /// </summary>
+    /// <typeparam name="I">The type of the input iterator.</typeparam>
+    /// <typeparam name="O">The type of the output iterator.</typeparam>
+    /// <param name="begin">The begin of the range to be converted.</param>
+    /// <param name="end">The end of the range to be converted.</param>
+    /// <param name="dst">The beginning of the destination range, which must
+    /// be able to hold the same number of elements as the source range.
+    /// </param>
+    template<class I, class O> void apply(I begin, I end, O dst) const;
+
+    /// <summary>
+    /// Answer the entries of the table, which are ordered by the bit
+    /// pattern of the input value.
+    /// </summary>
+    /// <returns>Pointer to <see cref="entries" /> values.</returns>
+    inline const value_type *data(void) const noexcept {
+        return this->values.data();
+    }
+
+    /// <summary>
+    /// Answer the converted value of <paramref name="value" />.
+    /// </summary>
+    /// <param name="value">The input value.</param>
+    /// <returns>The entry for <paramref name="value" />.</returns>
+    inline value_type& operator [](const source_type value) noexcept {
+        return this->values[lookup_table::index(value)];
+    }
+
+    /// <summary>
+    /// Answer the converted value of <paramref name="value" />.
+    /// </summary>
+    /// <param name="value">The input value.</param>
+    /// <returns>The entry for <paramref name="value" />.</returns>
+    inline const value_type& operator [](
+            const source_type value) const noexcept {
+        return this->values[lookup_table::index(value)];
+    }
+
+private:
+
+    /// <summary>
+    /// Fills <paramref name="dst" /> with the standard conversion of
+    /// <paramref name="src" />.
+    /// </summary>
+    template<class U>
+    static inline void fill_standard(const std::vector<source_type>& src,
+            std::vector<U>& dst) {
+        detail::convert_scalar<U>(src.begin(), src.end(), dst.begin());
+    }
+
+    /// <summary>
+    /// Fills <paramref name="dst" /> with the standard conversion of
+    /// <paramref name="src" /> to <c>float</c> narrowed to half precision.
+    /// </summary>
+    static void fill_standard(const std::vector<source_type>& src,
+        std::vector<float16>& dst);
+
+    /// <summary>
+    /// Answer the position of <paramref name="value" /> in the table.
+    /// </summary>
+    static inline size_type index(const source_type value) noexcept {
+        typedef typename std::make_unsigned<source_type>::type unsigned_type;
+        return static_cast<unsigned_type>(value);
+    }
+
+    /// <summary>
+    /// Initialises a new instance without computing the entries.
+    /// </summary>
+    inline explicit lookup_table(std::nullptr_t)
+        : values(lookup_table::entries()) { }
+
+    /// <summary>
+    /// The converted values.
+    /// </summary>
+    std::vector<value_type> values;
+};
+
+DATRAW_NAMESPACE_END
+
+#include "datraw/lookup_table.inl"
+
+#endif /* !defined(_DATRAW_LOOKUP_TABLE_H) */
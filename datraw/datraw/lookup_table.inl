@@ -0,0 +1,93 @@
+﻿// <copyright file="lookup_table.inl" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2026 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+
+/*
+ * DATRAW_NAMESPACE::lookup_table<S, T>::make
+ */
+template<class S, class T>
+template<class F>
+DATRAW_NAMESPACE::lookup_table<S, T>
+DATRAW_NAMESPACE::lookup_table<S, T>::make(F&& func) {
+    lookup_table retval(nullptr);
+
+    for (size_type i = 0; i < lookup_table::entries(); ++i) {
+        const auto value = static_cast<source_type>(i);
+        retval[value] = static_cast<value_type>(func(value));
+    }
+
+    return retval;
+}
+
+
+/*
+ * DATRAW_NAMESPACE::lookup_table<S, T>::lookup_table
+ */
+template<class S, class T>
+DATRAW_NAMESPACE::lookup_table<S, T>::lookup_table(void)
+        : values(lookup_table::entries()) {
+    // Enumerate all bit patterns in the order of the table.
+    std::vector<source_type> src(lookup_table::entries());
+    for (size_type i = 0; i < src.size(); ++i) {
+        src[i] = static_cast<source_type>(i);
+    }
+
+    lookup_table::fill_standard(src, this->values);
+}
+
+
+/*
+ * DATRAW_NAMESPACE::lookup_table<S, T>::apply
+ */
+template<class S, class T>
+template<class I, class O>
+void DATRAW_NAMESPACE::lookup_table<S, T>::apply(I begin, I end,
+        O dst) const {
+    auto table = this->values.data();
+    std::transform(begin, end, dst, [table](const source_type s) {
+        return table[lookup_table::index(s)];
+    });
+}
+
+
+/*
+ * DATRAW_NAMESPACE::lookup_table<S, T>::fill_standard
+ */
+template<class S, class T>
+void DATRAW_NAMESPACE::lookup_table<S, T>::fill_standard(
+        const std::vector<source_type>& src, std::vector<float16>& dst) {
+    std::vector<float> tmp(src.size());
+    detail::convert_scalar<float>(src.begin(), src.end(), tmp.begin());
+    DATRAW_NAMESPACE::float_to_half(tmp.data(), dst.data(), tmp.size());
+}
+
+
+/*
+ * DATRAW_DETAIL_NAMESPACE::convert_lookup
+ */
+template<class T, class I, class O>
+bool DATRAW_DETAIL_NAMESPACE::convert_lookup(I, I, O, std::false_type) {
+    return false;
+}
+
+
+/*
+ * DATRAW_DETAIL_NAMESPACE::convert_lookup
+ */
+template<class T, class I, class O>
+bool DATRAW_DETAIL_NAMESPACE::convert_lookup(I begin, I end, O dst,
+        std::true_type) {
+    typedef typename std::iterator_traits<I>::value_type source_type;
+    typedef lookup_table<source_type, T> table_type;
+
+    if (static_cast<std::size_t>(end - begin) < table_type::entries()) {
+        // Computing the table does not amortise for small ranges.
+        return false;
+    }
+
+    table_type::standard().apply(begin, end, dst);
+    return true;
+}
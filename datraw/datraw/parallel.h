@@ -0,0 +1,184 @@
+﻿// <copyright file="parallel.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2026 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_DATRAW_PARALLEL_H)
+#define _DATRAW_PARALLEL_H
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "datraw/abi.h"
+#include "datraw/thread_pool.h"
+
+
+DATRAW_DETAIL_NAMESPACE_BEGIN
+
+/// <summary>
+/// Answer the number of threads to be used if the caller requested
+/// <paramref name="concurrency" /> threads for <paramref name="count" />
+/// work items.
+/// </summary>
+/// <param name="concurrency">The requested number of threads, where zero
+/// means that the number of hardware threads should be used.</param>
+/// <param name="count">The number of work items.</param>
+/// <returns>The number of threads, which is at least one.</returns>
+inline std::size_t effective_concurrency(const std::size_t concurrency,
+        const std::size_t count) noexcept {
+    auto retval = concurrency;
+    if (retval == 0) {
+        retval = std::thread::hardware_concurrency();
+    }
+    return (std::max)((std::min)(retval, count), std::size_t(1));
+}
+
+
+/// <summary>
+/// Invokes <paramref name="func" /> for all indices in [0,
+/// <paramref name="count" />[ using at most <paramref name="concurrency" />
+/// threads, including the calling one.
+/// </summary>
+/// <remarks>
+/// <para>The work items are processed by the calling thread and the threads
+/// of the process-wide <see cref="thread_pool" />, ie no threads are created
+/// per call. The calling thread only waits for pool threads that have
+/// actually picked up work, so the method can also be used from within a
+/// task of the pool without deadlocking.</para>
+/// <para>The indices are handed out dynamically, ie work items of different
+/// cost are balanced between the threads.</para>
+/// <para>If any invocation throws, no further work items are started and the
+/// first exception is rethrown on the calling thread once all threads have
+/// finished.</para>
+/// </remarks>
+/// <typeparam name="F">The type of the function, which must accept a
+/// <see cref="std::size_t" /> index.</typeparam>
+/// <param name="count">The number of work items.</param>
+/// <param name="concurrency">The maximum number of threads, where zero means
+/// that the number of hardware threads should be used.</param>
+/// <param name="func">The function to be invoked for each work item.
+/// </param>
+template<class F>
+void parallel_for(const std::size_t count, const std::size_t concurrency,
+        F&& func) {
+    // The state is shared with the tasks in the pool, which might only start
+    // after we have returned.
+    struct state_type {
+        std::size_t active;
+        std::condition_variable condition;
+        bool done;
+        std::exception_ptr error;
+        std::mutex lock;
+        std::atomic<std::size_t> next;
+    };
+
+    auto state = std::make_shared<state_type>();
+    state->active = 0;
+    state->done = false;
+    state->next = 0;
+
+    auto f = &func;
+    auto worker = [count, f](state_type& s) {
+        std::size_t i;
+        while ((i = s.next++) < count) {
+            try {
+                (*f)(i);
+            } catch (...) {
+                std::lock_guard<std::mutex> l(s.lock);
+                if (!s.error) {
+                    s.error = std::current_exception();
+                }
+                s.next = count;
+            }
+        }
+    };
+
+    auto& pool = thread_pool::instance();
+    const auto cntHelpers = (std::min)(
+        effective_concurrency(concurrency, count) - 1, pool.size());
+    try {
+        for (std::size_t i = 0; i < cntHelpers; ++i) {
+            pool.submit([state, worker](void) {
+                {
+                    std::lock_guard<std::mutex> l(state->lock);
+                    if (state->done) {
+                        // The caller has finished all work items already and
+                        // the function might not exist any more.
+                        return;
+                    }
+                    ++state->active;
+                }
+
+                worker(*state);
+
+                {
+                    std::lock_guard<std::mutex> l(state->lock);
+                    --state->active;
+                }
+                state->condition.notify_all();
+            });
+        }
+    } catch (...) {
+        // If we cannot submit more tasks, we continue with the ones we have
+        // got.
+    }
+
+    worker(*state);
+
+    std::unique_lock<std::mutex> l(state->lock);
+    state->done = true;
+    state->condition.wait(l, [&state](void) {
+        return (state->active == 0);
+    });
+
+    if (state->error) {
+        std::rethrow_exception(state->error);
+    }
+}
+
+
+/// <summary>
+/// The number of bytes processed by a work item of
+/// <see cref="parallel_chunks" />, which is large enough to amortise the
+/// scheduling and small enough to stay in the L2 cache.
+/// </summary>
+inline constexpr std::size_t parallel_chunk_size(void) noexcept {
+    return 256 * 1024;
+}
+
+
+/// <summary>
+/// Splits the range [0, <paramref name="count" />[ into chunks of
+/// <paramref name="chunk" /> elements and invokes
+/// <paramref name="func" /> for each of them using at most
+/// <paramref name="concurrency" /> threads.
+/// </summary>
+/// <typeparam name="F">The type of the function, which must accept the
+/// begin and the end index of the chunk.</typeparam>
+/// <param name="count">The number of elements.</param>
+/// <param name="chunk">The number of elements in a chunk, which must not be
+/// zero.</param>
+/// <param name="concurrency">The maximum number of threads, where zero means
+/// that the number of hardware threads should be used.</param>
+/// <param name="func">The function to be invoked for each chunk.</param>
+template<class F>
+void parallel_chunks(const std::size_t count, const std::size_t chunk,
+        const std::size_t concurrency, F&& func) {
+    const auto cntChunks = (count + chunk - 1) / chunk;
+    parallel_for(cntChunks, concurrency, [&](const std::size_t c) {
+        const auto begin = c * chunk;
+        func(begin, (std::min)(count, begin + chunk));
+    });
+}
+
+DATRAW_DETAIL_NAMESPACE_END
+
+#endif /* !defined(_DATRAW_PARALLEL_H) */
@@ -0,0 +1,275 @@
+﻿// <copyright file="prefetching_raw_reader.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2026 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_DATRAW_PREFETCHING_RAW_READER_H)
+#define _DATRAW_PREFETCHING_RAW_READER_H
+#pragma once
+
+#include <deque>
+#include <future>
+#include <utility>
+#include <vector>
+
+#include "datraw/raw_reader.h"
+
+
+DATRAW_NAMESPACE_BEGIN
+
+/// <summary>
+/// A reader for time series which loads the time steps following the
+/// current one on background threads.
+/// </summary>
+/// <remarks>
+/// <para>The reader keeps up to <see cref="depth" /> time steps after the
+/// current one in flight. When moving to the next time step, the data of
+/// this step have therefore most likely been loaded already while the
+/// caller was processing the previous one, and
+/// <see cref="read_current" /> only hands over the buffer.</para>
+/// <para>Instances of the class are not thread-safe, ie the reader must
+/// only be used from one thread at a time. The background reads do not
+/// share any state with the reader.</para>
+/// </remarks>
+template<class C> class prefetching_raw_reader {
+
+public:
+
+    /// <summary>
+    /// The type used to represent a single character in a string.
+    /// </summary>
+    typedef C char_type;
+
+    /// <summary>
+    /// The type of the underlying <see cref="raw_reader" />.
+    /// </summary>
+    typedef datraw::raw_reader<char_type> reader_type;
+
+    /// <summary>
+    /// The type of the <see cref="info" /> object representing the dat
+    /// file.
+    /// </summary>
+    typedef typename reader_type::info_type info_type;
+
+    /// <summary>
+    /// The type to express file sizes.
+    /// </summary>
+    typedef typename reader_type::size_type size_type;
+
+    /// <summary>
+    /// The type used to represent a string.
+    /// </summary>
+    typedef typename reader_type::string_type string_type;
+
+    /// <summary>
+    /// The type to express a time step.
+    /// </summary>
+    typedef typename reader_type::time_step_type time_step_type;
+
+    /// <summary>
+    /// The number of time steps that are prefetched if nothing else is
+    /// specified.
+    /// </summary>
+    static const size_type default_depth = 2;
+
+    /// <summary>
+    /// Open a new reader for the specifie dat file.
+    /// </summary>
+    /// <param name="datPath">The path to the dat file.</param>
+    /// <param name="depth">The number of time steps that should be loaded
+    /// ahead of the current one.</param>
+    /// <returns>A reader for the raw data described in the dat file.
+    /// </returns>
+    static inline prefetching_raw_reader open(const string_type& datPath,
+            const size_type depth = default_depth) {
+        return prefetching_raw_reader(reader_type::open(datPath), depth);
+    }
+
+    /// <summary>
+    /// Initialises a new instance.
+    /// </summary>
+    /// <param name="reader">The reader used to load the data. The reader
+    /// determines the current time step of the new instance.</param>
+    /// <param name="depth">The number of time steps that should be loaded
+    /// ahead of the current one.</param>
+    explicit prefetching_raw_reader(const reader_type& reader,
+        const size_type depth = default_depth);
+
+    prefetching_raw_reader(const prefetching_raw_reader&) = delete;
+
+    /// <summary>
+    /// Move <paramref name="rhs" /> into a new instance.
+    /// </summary>
+    /// <param name="rhs">The object to be moved.</param>
+    prefetching_raw_reader(prefetching_raw_reader&& rhs) = default;
+
+    /// <summary>
+    /// Finalises the instance.
+    /// </summary>
+    /// <remarks>
+    /// The destructor blocks until all outstanding background reads have
+    /// completed.
+    /// </remarks>
+    ~prefetching_raw_reader(void) = default;
+
+    /// <summary>
+    /// Answer the content of the dat file.
+    /// </summary>
+    /// <returns>The content of the dat file.</returns>
+    inline const info_type& info(void) const noexcept {
+        return this->reader.info();
+    }
+
+    /// <summary>
+    /// Answer the current time step.
+    /// </summary>
+    /// <returns>The current time step.</returns>
+    inline time_step_type current(void) const noexcept {
+        return this->reader.current();
+    }
+
+    /// <summary>
+    /// Answer the number of time steps that are loaded ahead of the
+    /// current one.
+    /// </summary>
+    /// <returns>The prefetch depth.</returns>
+    inline size_type depth(void) const noexcept {
+        return this->prefetchDepth;
+    }
+
+    /// <summary>
+    /// Answer whether, according to the <see cref="info" />, there is
+    /// another time step after the current one.
+    /// </summary>
+    /// <returns><c>true</c> if there is another time step, <c>false</c>
+    /// otherwise.</returns>
+    inline bool has_next(void) const {
+        return this->reader.has_next();
+    }
+
+    /// <summary>
+    /// Advance to the next time step.
+    /// </summary>
+    /// <returns><c>true</c> if the new time step is valid, <c>false</c>
+    /// if the end of the time series has been reached.</returns>
+    bool move_next(void);
+
+    /// <summary>
+    /// Move to the specified time step.
+    /// </summary>
+    /// <remarks>
+    /// Prefetched time steps before <paramref name="timeStep" /> or beyond
+    /// the prefetch window are discarded.
+    /// </remarks>
+    /// <param name="timeStep">The time step to move to.</param>
+    /// <returns><c>true</c> if the new time step is valid, <c>false</c>
+    /// otherwise.</returns>
+    bool move_to(const time_step_type timeStep);
+
+    /// <summary>
+    /// Read the content of the current time step.
+    /// </summary>
+    /// <remarks>
+    /// <para>If the current time step has been prefetched, the buffer is
+    /// handed over to the caller, waiting for the background read to
+    /// complete if necessary. Otherwise, the data are read
+    /// synchronously.</para>
+    /// <para>The method will swap the byte order as necessary, ie it is
+    /// guaranteed that the data returned match the byte order of the
+    /// system.</para>
+    /// </remarks>
+    /// <returns>The content of the current time step.</returns>
+    /// <exception cref="std::range_error">If the time series has been
+    /// completely read, ie the current time step is invalid.</exception>
+    /// <exception cref="std::invalid_argument">If the path of the current
+    /// time step was invalid, ie the raw file could not be opened.
+    /// </exception>
+    std::vector<datraw::uint8> read_current(void);
+
+    /// <summary>
+    /// Advance to the next time step and read it.
+    /// </summary>
+    /// <returns>The content of the next time step, or an empty buffer if
+    /// the end of the time series has been reached.</returns>
+    /// <exception cref="std::invalid_argument">If the path of the next
+    /// time step was invalid, ie the raw file could not be opened.
+    /// </exception>
+    inline std::vector<datraw::uint8> read_next(void) {
+        return this->move_next()
+            ? this->read_current()
+            : std::vector<datraw::uint8>();
+    }
+
+    /// <summary>
+    /// Reset the reader to the first time step.
+    /// </summary>
+    inline void reset(void) {
+        this->move_to(0);
+    }
+
+    prefetching_raw_reader& operator =(
+        const prefetching_raw_reader&) = delete;
+
+    /// <summary>
+    /// Move assignment.
+    /// </summary>
+    /// <param name="rhs">The object to be moved.</param>
+    /// <returns><c>*this</c>.</returns>
+    prefetching_raw_reader& operator =(
+        prefetching_raw_reader&& rhs) = default;
+
+    /// <summary>
+    /// Answer whether the current time step is valid.
+    /// </summary>
+    /// <returns><c>true</c> if the current time step is valid,
+    /// <c>false</c> otherwise.</returns>
+    inline operator bool(void) const {
+        return static_cast<bool>(this->reader);
+    }
+
+private:
+
+    /// <summary>
+    /// A time step which is being loaded in the background.
+    /// </summary>
+    typedef std::pair<time_step_type, std::future<std::vector<datraw::uint8>>>
+        pending_type;
+
+    /// <summary>
+    /// Discards all prefetched time steps that are not within the window
+    /// starting at the current time step and schedules the missing ones.
+    /// </summary>
+    /// <remarks>
+    /// If the current time step has already been handed over to the caller,
+    /// the window starts at the next time step.
+    /// </remarks>
+    void prefetch(void);
+
+    /// <summary>
+    /// Remembers whether the buffer of the current time step has already
+    /// been handed over to the caller.
+    /// </summary>
+    bool handedOver;
+
+    /// <summary>
+    /// The time steps which are being loaded, sorted in ascending order.
+    /// </summary>
+    std::deque<pending_type> pending;
+
+    /// <summary>
+    /// The number of time steps that are loaded ahead of the current one.
+    /// </summary>
+    size_type prefetchDepth;
+
+    /// <summary>
+    /// The reader tracking the current time step.
+    /// </summary>
+    reader_type reader;
+};
+
+DATRAW_NAMESPACE_END
+
+#include "datraw/prefetching_raw_reader.inl"
+
+#endif /* !defined(_DATRAW_PREFETCHING_RAW_READER_H) */
@@ -0,0 +1,104 @@
+﻿// <copyright file="prefetching_raw_reader.inl" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2026 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+
+/*
+ * DATRAW_NAMESPACE::prefetching_raw_reader<C>::prefetching_raw_reader
+ */
+template<class C>
+DATRAW_NAMESPACE::prefetching_raw_reader<C>::prefetching_raw_reader(
+        const reader_type& reader, const size_type depth)
+        : handedOver(false), prefetchDepth(depth), reader(reader) {
+    this->prefetch();
+}
+
+
+/*
+ * DATRAW_NAMESPACE::prefetching_raw_reader<C>::move_next
+ */
+template<class C>
+bool DATRAW_NAMESPACE::prefetching_raw_reader<C>::move_next(void) {
+    auto retval = this->reader.move_next();
+    this->handedOver = false;
+    this->prefetch();
+    return retval;
+}
+
+
+/*
+ * DATRAW_NAMESPACE::prefetching_raw_reader<C>::move_to
+ */
+template<class C>
+bool DATRAW_NAMESPACE::prefetching_raw_reader<C>::move_to(
+        const time_step_type timeStep) {
+    auto retval = this->reader.move_to(timeStep);
+    this->handedOver = false;
+    this->prefetch();
+    return retval;
+}
+
+
+/*
+ * DATRAW_NAMESPACE::prefetching_raw_reader<C>::read_current
+ */
+template<class C>
+std::vector<DATRAW_NAMESPACE::uint8>
+DATRAW_NAMESPACE::prefetching_raw_reader<C>::read_current(void) {
+    if (!this->pending.empty()
+            && (this->pending.front().first == this->reader.current())) {
+        // The time step is (being) loaded, so hand over the buffer. Make
+        // sure to keep the window filled before blocking on the data.
+        auto future = std::move(this->pending.front().second);
+        this->pending.pop_front();
+        this->handedOver = true;
+        this->prefetch();
+        return future.get();
+
+    } else {
+        // The time step has been consumed before or the reader does not
+        // prefetch at all, so read synchronously.
+        return this->reader.read_current();
+    }
+}
+
+
+/*
+ * DATRAW_NAMESPACE::prefetching_raw_reader<C>::prefetch
+ */
+template<class C>
+void DATRAW_NAMESPACE::prefetching_raw_reader<C>::prefetch(void) {
+    const auto cur = this->reader.current();
+    const auto cnt = this->reader.info().time_steps();
+    const auto first = this->handedOver ? cur + 1 : cur;
+    const auto last = (this->prefetchDepth > 0)
+        ? (std::min)(static_cast<time_step_type>(cur + this->prefetchDepth
+            + 1), cnt)
+        : first;
+    std::deque<pending_type> window;
+
+    for (auto t = first; t < last; ++t) {
+        while (!this->pending.empty() && (this->pending.front().first < t)) {
+            this->pending.pop_front();
+        }
+
+        if (!this->pending.empty() && (this->pending.front().first == t)) {
+            // Reuse the read which is already in flight.
+            window.push_back(std::move(this->pending.front()));
+            this->pending.pop_front();
+
+        } else {
+            // The task works on a copy of the reader such that it does not
+            // depend on the state or even the lifetime of this object.
+            auto r = this->reader;
+            window.emplace_back(t, std::async(std::launch::async,
+                [r, t](void) { return r.read(t); }));
+        }
+    }
+
+    // Note that this discards everything outside the window, which blocks
+    // until the respective reads have completed.
+    this->pending = std::move(window);
+}
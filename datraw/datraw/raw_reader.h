@@ -1,5 +1,5 @@
 ﻿// <copyright file="raw_reader.h" company="Visualisierungsinstitut der Universität Stuttgart">
-// Copyright © 2017 - 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Copyright © 2017 - 2026 Visualisierungsinstitut der Universität Stuttgart.
 // Licensed under the MIT licence. See LICENCE file for details.
 // </copyright>
 // <author>Christoph Müller</author>
@@ -8,11 +8,24 @@
 #define _DATRAW_RAW_READER_H
 #pragma once
 
+#include <algorithm>
+#include <cstring>
 #include <fstream>
+#include <future>
 #include <sstream>
+#include <vector>
 
+#include "datraw/access_pattern.h"
+#include "datraw/async_io.h"
 #include "datraw/convert.h"
+#include "datraw/default_init_allocator.h"
+#include "datraw/file.h"
+#include "datraw/file_cache.h"
+#include "datraw/frame_view.h"
 #include "datraw/info.h"
+#include "datraw/lookup_table.h"
+#include "datraw/parallel.h"
+#include "datraw/visit_scalar.h"
 
 
 DATRAW_NAMESPACE_BEGIN
@@ -79,21 +92,138 @@ public:
     /// <summary>
     /// Initialises a new instance.
     /// </summary>
-    inline raw_reader(void) noexcept : curTimeStep(0) { }
+    inline raw_reader(void)
+        : accessPattern(access_pattern::normal), curTimeStep(0),
+        directIo(false),
+        fileCache(std::make_shared<file_cache_type>()),
+        strictGeometry(false) { }
 
     /// <summary>
     /// Initialises a new instance for the given dat file content.
     /// </summary>
     /// <param name="info">The content of a dat file.</param>
     inline raw_reader(const info_type& info)
-        : curTimeStep(0), datInfo(info){ }
+        : accessPattern(access_pattern::normal), curTimeStep(0),
+        datInfo(info), directIo(false),
+        fileCache(std::make_shared<file_cache_type>()),
+        strictGeometry(false) { }
 
     /// <summary>
     /// Initialises a new instance for the given dat file content.
     /// </summary>
     /// <param name="info">The content of a dat file.</param>
-    inline raw_reader(info_type&& info) noexcept
-        : curTimeStep(0), datInfo(std::move(info)) { }
+    inline raw_reader(info_type&& info)
+        : accessPattern(access_pattern::normal), curTimeStep(0),
+        datInfo(std::move(info)), directIo(false),
+        fileCache(std::make_shared<file_cache_type>()),
+        strictGeometry(false) { }
+
+    /// <summary>
+    /// Answer how the application is expected to access the raw files.
+    /// </summary>
+    /// <returns>The access pattern the reader optimises for.</returns>
+    inline access_pattern access_policy(void) const noexcept {
+        return this->accessPattern;
+    }
+
+    /// <summary>
+    /// Tells the reader how the application will access the raw files.
+    /// </summary>
+    /// <remarks>
+    /// <para>The access pattern is passed on to the operating system via
+    /// <c>posix_fadvise</c> for the open raw files and <c>madvise</c> for
+    /// the views created by <see cref="map" />, which allows it to adapt
+    /// its readahead. It is only a hint, which is ignored on platforms that
+    /// do not support it.</para>
+    /// <para>In <see cref="access_pattern::sequential" /> mode, the pages of
+    /// a time step are released from the page cache once the reader moves
+    /// forward to a time step in another raw file.</para>
+    /// </remarks>
+    /// <param name="pattern">The expected access pattern.</param>
+    inline void access_policy(const access_pattern pattern) noexcept {
+        this->accessPattern = pattern;
+    }
+
+    /// <summary>
+    /// Closes all raw files that the reader keeps open.
+    /// </summary>
+    /// <remarks>
+    /// <para>The reader keeps the most recently used raw files open in order
+    /// to avoid opening them again for subsequent reads, which can be
+    /// expensive on network file systems. Before an open file is reused, the
+    /// reader checks whether it has been modified or replaced.</para>
+    /// <para>Copies of a reader share the open files.</para>
+    /// </remarks>
+    inline void clear_cache(void) {
+        this->fileCache->clear();
+    }
+
+    /// <summary>
+    /// Answer whether the reader bypasses the page cache of the operating
+    /// system.
+    /// </summary>
+    /// <returns><c>true</c> if direct I/O is used, <c>false</c> otherwise.
+    /// </returns>
+    inline bool direct_io(void) const noexcept {
+        return this->directIo;
+    }
+
+    /// <summary>
+    /// Enables or disables direct I/O.
+    /// </summary>
+    /// <remarks>
+    /// <para>Direct I/O bypasses the page cache of the operating system,
+    /// which prevents a single sweep over a huge data set from evicting all
+    /// other data from the cache. In turn, the data are not cached for
+    /// subsequent reads either.</para>
+    /// <para>All reads from the file are issued in windows that are
+    /// aligned as required by the file system, regardless of the data
+    /// offset. <see cref="map" /> reads the aligned window into an aligned
+    /// buffer instead of mapping the file and returns a view of the
+    /// requested part. The other methods copy the requested part from
+    /// aligned intermediate buffers unless the output buffer and the data
+    /// offset are aligned already.</para>
+    /// <para>If the file system does not support direct I/O, the reads
+    /// will fail with a <see cref="std::runtime_error" />.</para>
+    /// </remarks>
+    /// <param name="enable"><c>true</c> for enabling direct I/O,
+    /// <c>false</c> for using the page cache.</param>
+    inline void direct_io(const bool enable) noexcept {
+        this->directIo = enable;
+    }
+
+    /// <summary>
+    /// Answer whether the size of a frame is determined by the geometry
+    /// rather than by the size of the raw file.
+    /// </summary>
+    /// <returns><c>true</c> if the strict geometry mode is enabled,
+    /// <c>false</c> otherwise.</returns>
+    inline bool strict_geometry(void) const noexcept {
+        return this->strictGeometry;
+    }
+
+    /// <summary>
+    /// Enables or disables the strict geometry mode.
+    /// </summary>
+    /// <remarks>
+    /// <para>By default, a frame comprises all data from the data offset to
+    /// the end of the raw file. In strict geometry mode, the size of a frame
+    /// is computed by <see cref="info_type::frame_size" />, ie exactly the
+    /// voxels of the volume are read and any additional data at the end of
+    /// the raw file are ignored. Raw files that are smaller than the volume
+    /// are rejected.</para>
+    /// <para>In this mode, querying the size of a frame by passing
+    /// <c>nullptr</c> to <see cref="read" /> does not access the file
+    /// system.</para>
+    /// <para>The strict geometry mode can only be enabled for Cartesian and
+    /// rectilinear grids. For other grids, all reads will fail with a
+    /// <see cref="std::runtime_error" />.</para>
+    /// </remarks>
+    /// <param name="enable"><c>true</c> for enabling the strict geometry
+    /// mode, <c>false</c> for reading the whole raw file.</param>
+    inline void strict_geometry(const bool enable) noexcept {
+        this->strictGeometry = enable;
+    }
 
     /// <summary>
     /// Answer the content of the dat file.
@@ -121,6 +251,53 @@ public:
         return (this->curTimeStep + 1 < this->datInfo.time_steps());
     }
 
+    /// <summary>
+    /// Map the raw file of the specified time step into memory and return a
+    /// read-only view of its data.
+    /// </summary>
+    /// <remarks>
+    /// <para>The view returned has already been adjusted for the data
+    /// offset, ie it starts with the first byte of the actual data.</para>
+    /// <para>The method will swap the byte order as necessary, ie it is
+    /// guaranteed that the data returned match the byte order of the
+    /// system. If no conversion is required, the view directly exposes the
+    /// mapped file such that no copy is made. Otherwise, the view holds a
+    /// private, swapped copy of the data.</para>
+    /// <para>If <see cref="direct_io" /> is enabled, the file is not mapped,
+    /// but the view holds an aligned buffer which has been read directly
+    /// from the file.</para>
+    /// </remarks>
+    /// <param name="timeStep">The time step to be mapped.</param>
+    /// <returns>A view of the data of the requested time step.</returns>
+    /// <exception cref="std::range_error">If the time step is invalid.
+    /// </exception>
+    /// <exception cref="std::invalid_argument">If the path of the time step
+    /// was invalid, ie the raw file could not be opened.</exception>
+    /// <exception cref="std::runtime_error">If the raw file could not be
+    /// mapped.</exception>
+    frame_view map(const time_step_type timeStep) const;
+
+    /// <summary>
+    /// Map the raw file of the current time step into memory and return a
+    /// read-only view of its data.
+    /// </summary>
+    /// <remarks>
+    /// <para>The method will swap the byte order as necessary, ie it is
+    /// guaranteed that the data returned match the byte order of the
+    /// system.</para>
+    /// </remarks>
+    /// <returns>A view of the data of the current time step.</returns>
+    /// <exception cref="std::range_error">If the time series has been
+    /// completely read, ie the current time step is invalid.</exception>
+    /// <exception cref="std::invalid_argument">If the path of the current
+    /// time step was invalid, ie the raw file could not be opened.
+    /// </exception>
+    /// <exception cref="std::runtime_error">If the raw file could not be
+    /// mapped.</exception>
+    inline frame_view map_current(void) const {
+        return this->map(this->curTimeStep);
+    }
+
     /// <summary>
     /// Move to the next time step and answer whether this is valid according
     /// to the <see cref="info" />.
@@ -128,7 +305,7 @@ public:
     /// <returns><c>true</c> if the new time step is valid, <c>false</c>
     /// otherwise.</returns>
     inline bool move_next(void) {
-        ++this->curTimeStep;
+        this->move_to(this->curTimeStep + 1);
         return static_cast<bool>(*this);
     }
 
@@ -140,10 +317,362 @@ public:
     /// <returns><c>true</c> if the new time step is valid, <c>false</c>
     /// otherwise.</returns>
     inline bool move_to(const time_step_type timeStep) {
+        const auto previous = this->curTimeStep;
         this->curTimeStep = timeStep;
+        if ((this->accessPattern == access_pattern::sequential)
+                && (timeStep > previous)) {
+            this->release(previous);
+        }
         return static_cast<bool>(*this);
     }
 
+    /// <summary>
+    /// Read the content of the specified time step and store it to
+    /// <paramref name="dst" /> provided the buffer size
+    /// (<paramref name="cntDst" />) is large enough.
+    /// </summary>
+    /// <remarks>
+    /// <para>The method will swap the byte order as necessary, ie it is
+    /// guaranteed that the data returned match the byte order of the
+    /// system.</para>
+    /// <para>The method does not change the state of the reader and can
+    /// therefore be called concurrently from multiple threads.</para>
+    /// </remarks>
+    /// <param name="timeStep">The time step to be read.</param>
+    /// <param name="dst">Pointer to <paramref name="cntDst" /> bytes of
+    /// memory where the raw data can be stored. Nothing will be written if
+    /// this is <c>nullptr</c>.</param>
+    /// <param name="cntDst">The size of the buffer <paramref name="dst" />
+    /// in bytes. Nothing will be written if this is less than the required
+    /// number of bytes to hold the whole time step.</param>
+    /// <returns>The size of the time step in bytes. The return value is
+    /// independent from whether data have actually been written.</returns>
+    /// <exception cref="std::range_error">If the time step is invalid.
+    /// </exception>
+    /// <exception cref="std::invalid_argument">If the path of the time step
+    /// was invalid, ie the raw file could not be opened.</exception>
+    size_type read(const time_step_type timeStep, void *dst,
+        const size_type cntDst) const;
+
+    /// <summary>
+    /// Read the content of the specified time step and store it in a new
+    /// <see cref="std::vector" />.
+    /// </summary>
+    /// <remarks>
+    /// <para>The method will swap the byte order as necessary, ie it is
+    /// guaranteed that the data returned match the byte order of the
+    /// system.</para>
+    /// <para>The method does not change the state of the reader and can
+    /// therefore be called concurrently from multiple threads.</para>
+    /// </remarks>
+    /// <param name="timeStep">The time step to be read.</param>
+    /// <returns>The content of the time step.</returns>
+    /// <exception cref="std::range_error">If the time step is invalid.
+    /// </exception>
+    /// <exception cref="std::invalid_argument">If the path of the time step
+    /// was invalid, ie the raw file could not be opened.</exception>
+    inline std::vector<datraw::uint8> read(
+            const time_step_type timeStep) const {
+        return this->read(timeStep, std::allocator<datraw::uint8>());
+    }
+
+    /// <summary>
+    /// Read the content of the specified time step and store it in a new
+    /// <see cref="std::vector" /> using the given allocator.
+    /// </summary>
+    /// <remarks>
+    /// <para>The raw file is opened only once and the buffer is sized using
+    /// <c>resize</c>. In combination with
+    /// <see cref="default_init_allocator" />, the buffer is therefore not
+    /// zeroed before the data are read into it.</para>
+    /// <para>The method will swap the byte order as necessary, ie it is
+    /// guaranteed that the data returned match the byte order of the
+    /// system.</para>
+    /// <para>The method does not change the state of the reader and can
+    /// therefore be called concurrently from multiple threads.</para>
+    /// </remarks>
+    /// <typeparam name="A">The allocator for bytes used by the
+    /// vector.</typeparam>
+    /// <param name="timeStep">The time step to be read.</param>
+    /// <param name="allocator">The allocator for the vector.</param>
+    /// <returns>The content of the time step.</returns>
+    /// <exception cref="std::range_error">If the time step is invalid.
+    /// </exception>
+    /// <exception cref="std::invalid_argument">If the path of the time step
+    /// was invalid, ie the raw file could not be opened.</exception>
+    template<class A>
+    std::vector<datraw::uint8, A> read(const time_step_type timeStep,
+        const A& allocator) const;
+
+    /// <summary>
+    /// Read the content of the specified time step and store it in a new
+    /// uninitialised array.
+    /// </summary>
+    /// <remarks>
+    /// <para>The raw file is opened only once and the array is not
+    /// initialised before the data are read into it.</para>
+    /// <para>The method will swap the byte order as necessary, ie it is
+    /// guaranteed that the data returned match the byte order of the
+    /// system.</para>
+    /// <para>The method does not change the state of the reader and can
+    /// therefore be called concurrently from multiple threads.</para>
+    /// </remarks>
+    /// <param name="timeStep">The time step to be read.</param>
+    /// <param name="size">Receives the size of the array in bytes.</param>
+    /// <returns>The content of the time step.</returns>
+    /// <exception cref="std::range_error">If the time step is invalid.
+    /// </exception>
+    /// <exception cref="std::invalid_argument">If the path of the time step
+    /// was invalid, ie the raw file could not be opened.</exception>
+    std::unique_ptr<datraw::uint8[]> read(const time_step_type timeStep,
+        size_type& size) const;
+
+    /// <summary>
+    /// Read the content of the specified time step, convert it to
+    /// <typeparamref name="T" /> and store it to <paramref name="dst" />
+    /// provided the buffer size (<paramref name="cntDst" />) is large
+    /// enough.
+    /// </summary>
+    /// <remarks>
+    /// <para>The raw file is streamed through a staging buffer that fits
+    /// into the cache. Each block is swapped and converted as described for
+    /// <see cref="convert" /> right after it has been read, ie the frame
+    /// passes the memory bus only once and no buffer for the whole raw frame
+    /// is required. If the data do not need to be converted, they are read
+    /// directly into <paramref name="dst" />.</para>
+    /// <para>The method does not change the state of the reader and can
+    /// therefore be called concurrently from multiple threads.</para>
+    /// </remarks>
+    /// <typeparam name="T">The scalar type of the output.</typeparam>
+    /// <param name="timeStep">The time step to be read.</param>
+    /// <param name="dst">Pointer to <paramref name="cntDst" /> scalars
+    /// where the converted data can be stored. Nothing will be written if
+    /// this is <c>nullptr</c>.</param>
+    /// <param name="cntDst">The number of scalars that
+    /// <paramref name="dst" /> can hold. Nothing will be written if this is
+    /// less than the number of scalars in the time step.</param>
+    /// <returns>The number of scalars in the time step. The return value is
+    /// independent from whether data have actually been written.</returns>
+    /// <exception cref="std::range_error">If the time step is invalid.
+    /// </exception>
+    /// <exception cref="std::invalid_argument">If the path of the time step
+    /// was invalid, ie the raw file could not be opened.</exception>
+    /// <exception cref="std::runtime_error">If the format of the data is
+    /// <see cref="scalar_type::raw" />, which cannot be converted.
+    /// </exception>
+    template<class T>
+    size_type read_as(const time_step_type timeStep, T *dst,
+        const size_type cntDst) const;
+
+    /// <summary>
+    /// Read the content of the specified time step, convert it using the
+    /// given <paramref name="table" /> and store it to
+    /// <paramref name="dst" /> provided the buffer size
+    /// (<paramref name="cntDst" />) is large enough.
+    /// </summary>
+    /// <remarks>
+    /// <para>This method works like the other overload of
+    /// <see cref="read_as" />, but applies a custom conversion like a
+    /// window/level transfer function. The table can be reused for all
+    /// frames of the time series.</para>
+    /// </remarks>
+    /// <typeparam name="S">The scalar type of the raw data, which must match
+    /// the format of the data set.</typeparam>
+    /// <typeparam name="T">The scalar type of the output.</typeparam>
+    /// <param name="timeStep">The time step to be read.</param>
+    /// <param name="table">The table holding the converted values.</param>
+    /// <param name="dst">Pointer to <paramref name="cntDst" /> scalars
+    /// where the converted data can be stored. Nothing will be written if
+    /// this is <c>nullptr</c>.</param>
+    /// <param name="cntDst">The number of scalars that
+    /// <paramref name="dst" /> can hold. Nothing will be written if this is
+    /// less than the number of scalars in the time step.</param>
+    /// <returns>The number of scalars in the time step. The return value is
+    /// independent from whether data have actually been written.</returns>
+    /// <exception cref="std::range_error">If the time step is invalid.
+    /// </exception>
+    /// <exception cref="std::invalid_argument">If the path of the time step
+    /// was invalid, ie the raw file could not be opened.</exception>
+    /// <exception cref="std::runtime_error">If the format of the data is not
+    /// <typeparamref name="S" />.</exception>
+    template<class S, class T>
+    size_type read_as(const time_step_type timeStep,
+        const lookup_table<S, T>& table, T *dst,
+        const size_type cntDst) const;
+
+    /// <summary>
+    /// Asynchronously read the content of the specified time step and store
+    /// it to <paramref name="dst" /> provided the buffer size
+    /// (<paramref name="cntDst" />) is large enough.
+    /// </summary>
+    /// <remarks>
+    /// <para>The method opens the raw file and submits the read to the
+    /// process-wide asynchronous I/O backend, which uses io_uring on Linux
+    /// if available and a pool of threads otherwise. Many reads can
+    /// therefore be in flight without blocking a thread for each of
+    /// them.</para>
+    /// <para>The buffer <paramref name="dst" /> must remain valid until the
+    /// returned future is ready.</para>
+    /// <para>The byte order will be swapped as necessary before the future
+    /// becomes ready, ie it is guaranteed that the data returned match the
+    /// byte order of the system.</para>
+    /// </remarks>
+    /// <param name="timeStep">The time step to be read.</param>
+    /// <param name="dst">Pointer to <paramref name="cntDst" /> bytes of
+    /// memory where the raw data can be stored. Nothing will be written if
+    /// this is <c>nullptr</c>.</param>
+    /// <param name="cntDst">The size of the buffer <paramref name="dst" />
+    /// in bytes. Nothing will be written if this is less than the required
+    /// number of bytes to hold the whole time step.</param>
+    /// <returns>A future for the size of the time step in bytes, which
+    /// rethrows any error that occurred while reading.</returns>
+    /// <exception cref="std::range_error">If the time step is invalid.
+    /// </exception>
+    /// <exception cref="std::invalid_argument">If the path of the time step
+    /// was invalid, ie the raw file could not be opened.</exception>
+    std::future<size_type> read_async(const time_step_type timeStep,
+        void *dst, const size_type cntDst) const;
+
+    /// <summary>
+    /// Asynchronously read the content of <paramref name="count" /> time
+    /// steps starting at <paramref name="first" />.
+    /// </summary>
+    /// <remarks>
+    /// <para>All reads are submitted as a single batch. Cf.
+    /// <see cref="read_async" /> for details.</para>
+    /// </remarks>
+    /// <param name="first">The first time step to be read.</param>
+    /// <param name="count">The number of time steps to be read.</param>
+    /// <param name="dst">An array of <paramref name="count" /> pointers to
+    /// the buffers for the time steps. Nothing will be written to a buffer
+    /// if it is <c>nullptr</c>.</param>
+    /// <param name="cntDst">An array of <paramref name="count" /> sizes of
+    /// the buffers in <paramref name="dst" /> in bytes. Nothing will be
+    /// written to a buffer if it is smaller than the respective time step.
+    /// </param>
+    /// <returns>A future for the size of each time step in bytes.</returns>
+    /// <exception cref="std::range_error">If any of the time steps is
+    /// invalid.</exception>
+    /// <exception cref="std::invalid_argument">If the path of any time step
+    /// was invalid, ie the raw file could not be opened.</exception>
+    std::vector<std::future<size_type>> read_range_async(
+        const time_step_type first, const time_step_type count,
+        void *const *dst, const size_type *cntDst) const;
+
+    /// <summary>
+    /// Read the content of <paramref name="count" /> time steps starting at
+    /// <paramref name="first" /> in parallel.
+    /// </summary>
+    /// <remarks>
+    /// <para>The time steps are read by up to
+    /// <paramref name="concurrency" /> threads at the same time, which is
+    /// required to saturate fast storage devices. Like
+    /// <see cref="read" />, the method does not change the state of the
+    /// reader.</para>
+    /// <para>The method will swap the byte order as necessary, ie it is
+    /// guaranteed that the data returned match the byte order of the
+    /// system.</para>
+    /// </remarks>
+    /// <param name="first">The first time step to be read.</param>
+    /// <param name="count">The number of time steps to be read.</param>
+    /// <param name="dst">An array of <paramref name="count" /> pointers to
+    /// the buffers for the time steps. Nothing will be written to a buffer
+    /// if it is <c>nullptr</c>.</param>
+    /// <param name="cntDst">An array of <paramref name="count" /> sizes of
+    /// the buffers in <paramref name="dst" /> in bytes. Nothing will be
+    /// written to a buffer if it is smaller than the respective time step.
+    /// </param>
+    /// <param name="concurrency">The maximum number of time steps read at
+    /// the same time. If this is zero, the number of hardware threads is
+    /// used.</param>
+    /// <returns>The sizes of the time steps in bytes. The return value is
+    /// independent from whether data have actually been written.</returns>
+    /// <exception cref="std::range_error">If any of the time steps is
+    /// invalid.</exception>
+    /// <exception cref="std::invalid_argument">If the path of any time step
+    /// was invalid, ie the raw file could not be opened.</exception>
+    std::vector<size_type> read_range(const time_step_type first,
+        const time_step_type count, void *const *dst,
+        const size_type *cntDst, const size_type concurrency = 0) const;
+
+    /// <summary>
+    /// Read the content of <paramref name="count" /> time steps starting at
+    /// <paramref name="first" /> in parallel and store them in new
+    /// <see cref="std::vector" />s.
+    /// </summary>
+    /// <remarks>
+    /// <para>The time steps are read by up to
+    /// <paramref name="concurrency" /> threads at the same time, which is
+    /// required to saturate fast storage devices. Like
+    /// <see cref="read" />, the method does not change the state of the
+    /// reader.</para>
+    /// <para>The method will swap the byte order as necessary, ie it is
+    /// guaranteed that the data returned match the byte order of the
+    /// system.</para>
+    /// </remarks>
+    /// <param name="first">The first time step to be read.</param>
+    /// <param name="count">The number of time steps to be read.</param>
+    /// <param name="concurrency">The maximum number of time steps read at
+    /// the same time. If this is zero, the number of hardware threads is
+    /// used.</param>
+    /// <returns>The contents of the time steps.</returns>
+    /// <exception cref="std::range_error">If any of the time steps is
+    /// invalid.</exception>
+    /// <exception cref="std::invalid_argument">If the path of any time step
+    /// was invalid, ie the raw file could not be opened.</exception>
+    std::vector<std::vector<datraw::uint8>> read_range(
+        const time_step_type first, const time_step_type count,
+        const size_type concurrency = 0) const;
+
+    /// <summary>
+    /// Read the content of <paramref name="count" /> time steps starting at
+    /// <paramref name="first" /> in parallel into a single four-dimensional
+    /// buffer.
+    /// </summary>
+    /// <remarks>
+    /// <para>Time step <c>first + i</c> is read directly into the slot
+    /// starting at byte <c>i * framePitch</c> of <paramref name="dst" />,
+    /// ie no intermediate copy is made. The byte order is swapped as
+    /// necessary for each frame. Bytes between the end of a frame and the
+    /// begin of the next slot are not written.</para>
+    /// <para>Unless <see cref="strict_geometry" /> is enabled, the raw files
+    /// of all time steps are opened in order to determine the size of the
+    /// frames.</para>
+    /// <para>Like <see cref="read" />, the method does not change the state
+    /// of the reader.</para>
+    /// </remarks>
+    /// <param name="first">The first time step to be read.</param>
+    /// <param name="count">The number of time steps to be read.</param>
+    /// <param name="dst">Pointer to <paramref name="cntDst" /> bytes of
+    /// memory where the time steps can be stored. Nothing will be written if
+    /// this is <c>nullptr</c>.</param>
+    /// <param name="cntDst">The size of the buffer <paramref name="dst" />
+    /// in bytes. Nothing will be written if this is less than the required
+    /// number of bytes.</param>
+    /// <param name="framePitch">The distance between the begin of two
+    /// consecutive frames in <paramref name="dst" /> in bytes. If this is
+    /// zero, which is the default, the size of the largest frame is used,
+    /// ie frames of equal size are packed tightly.</param>
+    /// <param name="concurrency">The maximum number of time steps read at
+    /// the same time. If this is zero, the number of hardware threads is
+    /// used.</param>
+    /// <returns>The number of bytes required for all time steps, which is
+    /// the offset of the last slot plus the size of the last frame. The
+    /// return value is independent from whether data have actually been
+    /// written.</returns>
+    /// <exception cref="std::range_error">If any of the time steps is
+    /// invalid.</exception>
+    /// <exception cref="std::invalid_argument">If the path of any time step
+    /// was invalid, ie the raw file could not be opened, or if a frame is
+    /// larger than <paramref name="framePitch" />.</exception>
+    /// <exception cref="std::runtime_error">If the size of a frame changed
+    /// while reading, ie its slot has not been written as expected.
+    /// </exception>
+    size_type read_time_range(const time_step_type first,
+        const time_step_type count, void *dst, const size_type cntDst,
+        const size_type framePitch = 0,
+        const size_type concurrency = 0) const;
+
     /// <summary>
     /// Read the content of the current time step and store it to
     /// <paramref name="dst" /> provided the buffer size
@@ -167,7 +696,10 @@ public:
     /// <exception cref="std::invalid_argument">If the path of the current
     /// time step was invalid, ie the raw file could not be opened.
     /// </exception>
-    size_type read_current(void *dst, const size_type cntDst) const;
+    inline size_type read_current(void *dst, const size_type cntDst) const {
+        this->check_current();
+        return this->read(this->curTimeStep, dst, cntDst);
+    }
 
     /// <summary>
     /// Read the content of the current time step and store it in a new
@@ -185,12 +717,334 @@ public:
     /// time step was invalid, ie the raw file could not be opened.
     /// </exception>
     inline std::vector<datraw::uint8> read_current(void) const {
-        std::vector<datraw::uint8> retval;
-        retval.resize(this->read_current(nullptr, 0));
-        this->read_current(retval.data(), retval.size());
-        return retval;
+        this->check_current();
+        return this->read(this->curTimeStep);
+    }
+
+    /// <summary>
+    /// Read the content of the current time step and store it in a new
+    /// <see cref="std::vector" /> using the given allocator.
+    /// </summary>
+    /// <remarks>
+    /// <para>The raw file is opened only once and the buffer is sized using
+    /// <c>resize</c>. In combination with
+    /// <see cref="default_init_allocator" />, the buffer is therefore not
+    /// zeroed before the data are read into it.</para>
+    /// <para>The method will swap the byte order as necessary, ie it is
+    /// guaranteed that the data returned match the byte order of the
+    /// system.</para>
+    /// </remarks>
+    /// <typeparam name="A">The allocator for bytes used by the
+    /// vector.</typeparam>
+    /// <param name="allocator">The allocator for the vector.</param>
+    /// <returns>The content of the current time step.</returns>
+    /// <exception cref="std::range_error">If the time series has been
+    /// completely read, ie the current time step is invalid.</exception>
+    /// <exception cref="std::invalid_argument">If the path of the current
+    /// time step was invalid, ie the raw file could not be opened.
+    /// </exception>
+    template<class A>
+    inline std::vector<datraw::uint8, A> read_current(
+            const A& allocator) const {
+        this->check_current();
+        return this->read(this->curTimeStep, allocator);
+    }
+
+    /// <summary>
+    /// Read the content of the current time step and store it in a new
+    /// uninitialised array.
+    /// </summary>
+    /// <remarks>
+    /// <para>The raw file is opened only once and the array is not
+    /// initialised before the data are read into it.</para>
+    /// <para>The method will swap the byte order as necessary, ie it is
+    /// guaranteed that the data returned match the byte order of the
+    /// system.</para>
+    /// </remarks>
+    /// <param name="size">Receives the size of the array in bytes.</param>
+    /// <returns>The content of the current time step.</returns>
+    /// <exception cref="std::range_error">If the time series has been
+    /// completely read, ie the current time step is invalid.</exception>
+    /// <exception cref="std::invalid_argument">If the path of the current
+    /// time step was invalid, ie the raw file could not be opened.
+    /// </exception>
+    inline std::unique_ptr<datraw::uint8[]> read_current(
+            size_type& size) const {
+        this->check_current();
+        return this->read(this->curTimeStep, size);
     }
 
+    /// <summary>
+    /// Read the content of the current time step, convert it to
+    /// <typeparamref name="T" /> and store it to <paramref name="dst" />
+    /// provided the buffer size (<paramref name="cntDst" />) is large
+    /// enough.
+    /// </summary>
+    /// <remarks>
+    /// This method fuses reading, swapping the byte order and converting
+    /// the data as described for <see cref="read_as" />.
+    /// </remarks>
+    /// <typeparam name="T">The scalar type of the output.</typeparam>
+    /// <param name="dst">Pointer to <paramref name="cntDst" /> scalars
+    /// where the converted data can be stored. Nothing will be written if
+    /// this is <c>nullptr</c>.</param>
+    /// <param name="cntDst">The number of scalars that
+    /// <paramref name="dst" /> can hold. Nothing will be written if this is
+    /// less than the number of scalars in the time step.</param>
+    /// <returns>The number of scalars in the time step. The return value is
+    /// independent from whether data have actually been written.</returns>
+    /// <exception cref="std::range_error">If the time series has been
+    /// completely read, ie the current time step is invalid.</exception>
+    /// <exception cref="std::invalid_argument">If the path of the current
+    /// time step was invalid, ie the raw file could not be opened.
+    /// </exception>
+    /// <exception cref="std::runtime_error">If the format of the data is
+    /// <see cref="scalar_type::raw" />, which cannot be converted.
+    /// </exception>
+    template<class T>
+    inline size_type read_current_as(T *dst, const size_type cntDst) const {
+        this->check_current();
+        return this->read_as(this->curTimeStep, dst, cntDst);
+    }
+
+    /// <summary>
+    /// Read the content of the current time step, convert it using the
+    /// given <paramref name="table" /> and store it to
+    /// <paramref name="dst" /> provided the buffer size
+    /// (<paramref name="cntDst" />) is large enough.
+    /// </summary>
+    /// <typeparam name="S">The scalar type of the raw data, which must match
+    /// the format of the data set.</typeparam>
+    /// <typeparam name="T">The scalar type of the output.</typeparam>
+    /// <param name="table">The table holding the converted values.</param>
+    /// <param name="dst">Pointer to <paramref name="cntDst" /> scalars
+    /// where the converted data can be stored. Nothing will be written if
+    /// this is <c>nullptr</c>.</param>
+    /// <param name="cntDst">The number of scalars that
+    /// <paramref name="dst" /> can hold. Nothing will be written if this is
+    /// less than the number of scalars in the time step.</param>
+    /// <returns>The number of scalars in the time step. The return value is
+    /// independent from whether data have actually been written.</returns>
+    /// <exception cref="std::range_error">If the time series has been
+    /// completely read, ie the current time step is invalid.</exception>
+    /// <exception cref="std::invalid_argument">If the path of the current
+    /// time step was invalid, ie the raw file could not be opened.
+    /// </exception>
+    /// <exception cref="std::runtime_error">If the format of the data is not
+    /// <typeparamref name="S" />.</exception>
+    template<class S, class T>
+    inline size_type read_current_as(const lookup_table<S, T>& table,
+            T *dst, const size_type cntDst) const {
+        this->check_current();
+        return this->read_as(this->curTimeStep, table, dst, cntDst);
+    }
+
+    /// <summary>
+    /// Streams the current time step in chunks of at most
+    /// <paramref name="chunkSize" /> bytes to <paramref name="callback" />.
+    /// </summary>
+    /// <remarks>
+    /// <para>The method allows for processing time steps that do not fit
+    /// into memory as a whole. It allocates a single buffer of the chunk
+    /// size, which is reused for all chunks.</para>
+    /// <para>The chunk size is rounded down to a multiple of the size of an
+    /// element or, if this is unknown, of a scalar, such that no scalar is
+    /// split between two chunks. If the chunk size is smaller than a single
+    /// element, chunks of one element are used.</para>
+    /// <para>The method will swap the byte order of each chunk as necessary,
+    /// ie it is guaranteed that the data passed to the callback match the
+    /// byte order of the system.</para>
+    /// </remarks>
+    /// <typeparam name="F">The type of the callback, which must accept a
+    /// <c>const void *</c> to the data of the chunk, the size of the chunk
+    /// in bytes and the offset of the chunk from the begin of the time step
+    /// in bytes.</typeparam>
+    /// <param name="chunkSize">The maximum size of a chunk in bytes.</param>
+    /// <param name="callback">The callback that is invoked for each chunk
+    /// in order. The data passed to the callback are only valid until it
+    /// returns.</param>
+    /// <returns>The size of the time step in bytes.</returns>
+    /// <exception cref="std::range_error">If the time series has been
+    /// completely read, ie the current time step is invalid.</exception>
+    /// <exception cref="std::invalid_argument">If the path of the current
+    /// time step was invalid, ie the raw file could not be opened.
+    /// </exception>
+    template<class F>
+    size_type for_each_chunk(const size_type chunkSize, F&& callback) const;
+
+    /// <summary>
+    /// Read the axis-aligned sub-volume starting at
+    /// <paramref name="origin" /> with the size <paramref name="extent" />
+    /// from the current time step and store it to <paramref name="dst" />
+    /// provided the buffer size (<paramref name="cntDst" />) is large
+    /// enough.
+    /// </summary>
+    /// <remarks>
+    /// <para>This method can only be called if the grid is organised in rows
+    /// like for Cartesian and rectilinear ones.</para>
+    /// <para>Only the requested parts of the raw file are read. Adjacent
+    /// rows that are contiguous in the file are read at once.</para>
+    /// <para>The region is written densely packed to
+    /// <paramref name="dst" />, ie the rows of the region directly follow
+    /// each other.</para>
+    /// <para>The method will swap the byte order as necessary, ie it is
+    /// guaranteed that the data returned match the byte order of the
+    /// system.</para>
+    /// </remarks>
+    /// <param name="origin">The index of the first element of the region on
+    /// each axis of the grid.</param>
+    /// <param name="extent">The number of elements of the region on each
+    /// axis of the grid.</param>
+    /// <param name="dst">Pointer to <paramref name="cntDst" /> bytes of
+    /// memory where the region can be stored. Nothing will be written if
+    /// this is <c>nullptr</c>.</param>
+    /// <param name="cntDst">The size of the buffer <paramref name="dst" />
+    /// in bytes. Nothing will be written if this is less than the required
+    /// number of bytes to hold the whole region.</param>
+    /// <returns>The size of the region in bytes. The return value is
+    /// independent from whether data have actually been written.</returns>
+    /// <exception cref="std::range_error">If the time series has been
+    /// completely read, ie the current time step is invalid.</exception>
+    /// <exception cref="std::invalid_argument">If the region does not
+    /// match the dimensions of the grid or if it is not completely within
+    /// the grid, or if the raw file could not be opened or is too small.
+    /// </exception>
+    /// <exception cref="std::runtime_error">If the grid is not organised in
+    /// rows or if reading the file failed.</exception>
+    size_type read_region(const std::vector<std::uint32_t>& origin,
+        const std::vector<std::uint32_t>& extent, void *dst,
+        const size_type cntDst) const;
+
+    /// <summary>
+    /// Asynchronously read the axis-aligned sub-volume starting at
+    /// <paramref name="origin" /> with the size <paramref name="extent" />
+    /// from the current time step and store it to <paramref name="dst" />
+    /// provided the buffer size (<paramref name="cntDst" />) is large
+    /// enough.
+    /// </summary>
+    /// <remarks>
+    /// <para>The contiguous runs of rows forming the region are submitted as
+    /// a single request to the asynchronous I/O backend. Cf.
+    /// <see cref="read_region" /> and <see cref="read_async" /> for
+    /// details.</para>
+    /// <para>The buffer <paramref name="dst" /> must remain valid until the
+    /// returned future is ready.</para>
+    /// </remarks>
+    /// <param name="origin">The index of the first element of the region on
+    /// each axis of the grid.</param>
+    /// <param name="extent">The number of elements of the region on each
+    /// axis of the grid.</param>
+    /// <param name="dst">Pointer to <paramref name="cntDst" /> bytes of
+    /// memory where the region can be stored. Nothing will be written if
+    /// this is <c>nullptr</c>.</param>
+    /// <param name="cntDst">The size of the buffer <paramref name="dst" />
+    /// in bytes. Nothing will be written if this is less than the required
+    /// number of bytes to hold the whole region.</param>
+    /// <returns>A future for the size of the region in bytes, which
+    /// rethrows any error that occurred while reading.</returns>
+    /// <exception cref="std::range_error">If the time series has been
+    /// completely read, ie the current time step is invalid.</exception>
+    /// <exception cref="std::invalid_argument">If the region does not
+    /// match the dimensions of the grid or if it is not completely within
+    /// the grid, or if the raw file could not be opened or is too small.
+    /// </exception>
+    /// <exception cref="std::runtime_error">If the grid is not organised in
+    /// rows.</exception>
+    std::future<size_type> read_region_async(
+        const std::vector<std::uint32_t>& origin,
+        const std::vector<std::uint32_t>& extent,
+        void *dst, const size_type cntDst) const;
+
+    /// <summary>
+    /// Read the axis-aligned slice with the given <paramref name="index" />
+    /// orthogonal to <paramref name="axis" /> from the current time step and
+    /// store it to <paramref name="dst" /> provided the buffer size
+    /// (<paramref name="cntDst" />) is large enough.
+    /// </summary>
+    /// <remarks>
+    /// <para>This method can only be called if the grid is organised in rows
+    /// like for Cartesian and rectilinear ones.</para>
+    /// <para>A slice orthogonal to the last axis (the z-axis of a volume) is
+    /// contiguous in the raw file and read at once. For all other axes, the
+    /// slice is scattered in the file. If the gaps between the pieces are
+    /// small, like for a slice orthogonal to the x-axis, the method reads
+    /// large blocks and gathers the slice in memory. Otherwise, each piece,
+    /// which is at least a whole row in this case, is read directly.</para>
+    /// <para>The slice is written densely packed to <paramref name="dst" />
+    /// with the remaining axes in their original order, ie a slice
+    /// orthogonal to the x-axis of a volume is stored as rows along the
+    /// y-axis.</para>
+    /// <para>The method will swap the byte order as necessary, ie it is
+    /// guaranteed that the data returned match the byte order of the
+    /// system.</para>
+    /// </remarks>
+    /// <param name="axis">The zero-based index of the axis the slice is
+    /// orthogonal to.</param>
+    /// <param name="index">The position of the slice on
+    /// <paramref name="axis" />.</param>
+    /// <param name="dst">Pointer to <paramref name="cntDst" /> bytes of
+    /// memory where the slice can be stored. Nothing will be written if
+    /// this is <c>nullptr</c>.</param>
+    /// <param name="cntDst">The size of the buffer <paramref name="dst" />
+    /// in bytes. Nothing will be written if this is less than the required
+    /// number of bytes to hold the whole slice.</param>
+    /// <returns>The size of the slice in bytes. The return value is
+    /// independent from whether data have actually been written.</returns>
+    /// <exception cref="std::range_error">If the time series has been
+    /// completely read, ie the current time step is invalid.</exception>
+    /// <exception cref="std::invalid_argument">If the axis or the index
+    /// are out of range, or if the raw file could not be opened or is too
+    /// small.</exception>
+    /// <exception cref="std::runtime_error">If the grid is not organised in
+    /// rows or if reading the file failed.</exception>
+    size_type read_slice(const std::uint32_t axis, const std::uint32_t index,
+        void *dst, const size_type cntDst) const;
+
+    /// <summary>
+    /// Read the current time step into a padded destination layout where
+    /// consecutive rows are <paramref name="rowPitch" /> bytes and
+    /// consecutive slices are <paramref name="slicePitch" /> bytes apart.
+    /// </summary>
+    /// <remarks>
+    /// <para>This method can only be called if the grid is organised in rows
+    /// like for Cartesian and rectilinear ones.</para>
+    /// <para>A row is a line along the first axis, a slice is a plane
+    /// spanned by the first two axes of the grid. All remaining axes are
+    /// treated as a sequence of slices.</para>
+    /// <para>Rows larger than the gap size for gathering are read directly
+    /// into their final location. Smaller rows are read in large blocks
+    /// and scattered in memory while the block is still in the cache. The
+    /// padding between rows and slices is never written.</para>
+    /// <para>The method will swap the byte order as necessary, ie it is
+    /// guaranteed that the data returned match the byte order of the
+    /// system.</para>
+    /// </remarks>
+    /// <param name="rowPitch">The distance between the begin of two rows in
+    /// <paramref name="dst" /> in bytes, eg as computed by
+    /// <see cref="info::row_pitch" />. If this is zero, the rows are densely
+    /// packed.</param>
+    /// <param name="slicePitch">The distance between the begin of two slices
+    /// in <paramref name="dst" /> in bytes. If this is zero, the slices are
+    /// packed according to <paramref name="rowPitch" />.</param>
+    /// <param name="dst">Pointer to <paramref name="cntDst" /> bytes of
+    /// memory where the frame can be stored. Nothing will be written if
+    /// this is <c>nullptr</c>.</param>
+    /// <param name="cntDst">The size of the buffer <paramref name="dst" />
+    /// in bytes. Nothing will be written if this is less than the required
+    /// number of bytes to hold the whole padded frame.</param>
+    /// <returns>The size of the padded frame in bytes, which is measured up
+    /// to the end of the last row. The return value is independent from
+    /// whether data have actually been written.</returns>
+    /// <exception cref="std::range_error">If the time series has been
+    /// completely read, ie the current time step is invalid.</exception>
+    /// <exception cref="std::invalid_argument">If a pitch is smaller than
+    /// the data it must hold, or if the raw file could not be opened or is
+    /// too small.</exception>
+    /// <exception cref="std::runtime_error">If the grid is not organised in
+    /// rows or if reading the file failed.</exception>
+    size_type read_pitched(const size_type rowPitch,
+        const size_type slicePitch, void *dst, const size_type cntDst) const;
+
     /// <summary>
     /// Advance to the next time step and store the raw file in a new
     /// <see cref="std::vector" />.
@@ -226,6 +1080,148 @@ public:
 
 private:
 
+    /// <summary>
+    /// The size of the blocks read when gathering scattered data in memory.
+    /// </summary>
+    static inline constexpr size_type gather_block_size(void) noexcept {
+        return 8 * 1024 * 1024;
+    }
+
+    /// <summary>
+    /// The largest gap between two pieces of data that we rather read than
+    /// skip by issuing a separate read.
+    /// </summary>
+    static inline constexpr size_type gather_gap_size(void) noexcept {
+        return 64 * 1024;
+    }
+
+    /// <summary>
+    /// The size of the staging buffer used for converting data while
+    /// reading them, which should fit into the L2 cache.
+    /// </summary>
+    static inline constexpr size_type staging_block_size(void) noexcept {
+        return 256 * 1024;
+    }
+
+    /// <summary>
+    /// Makes sure that the current time step is valid.
+    /// </summary>
+    inline void check_current(void) const {
+        if (this->curTimeStep >= this->datInfo.time_steps()) {
+            throw std::range_error("All time steps have been consumed "
+                "already.");
+        }
+    }
+
+    /// <summary>
+    /// Makes sure that <paramref name="timeStep" /> is valid.
+    /// </summary>
+    void check_time_step(const time_step_type timeStep) const;
+
+    /// <summary>
+    /// Checks that the grid is organised in rows and that the current time
+    /// step is valid, and answer the size of an element and the resolution.
+    /// </summary>
+    size_type check_row_access(std::vector<std::uint32_t>& resolution) const;
+
+    /// <summary>
+    /// The type of the cache for open raw files.
+    /// </summary>
+    typedef detail::file_cache<char_type> file_cache_type;
+
+    /// <summary>
+    /// The type of a handle to an open raw file.
+    /// </summary>
+    typedef typename file_cache_type::file_type file_type;
+
+    /// <summary>
+    /// Prepares an asynchronous read of <paramref name="size" /> bytes to
+    /// <paramref name="dst" />, which will be fulfilled via
+    /// <paramref name="future" />.
+    /// </summary>
+    /// <remarks>
+    /// The request swaps the byte order of each segment once it has been read
+    /// if <paramref name="dst" /> is not <c>nullptr</c>. The caller must add
+    /// the reads to the request.
+    /// </remarks>
+    detail::async_io::request_type async_request(file_type&& file,
+        void *dst, const size_type size,
+        std::future<size_type>& future) const;
+
+    /// <summary>
+    /// Answer the backend for asynchronous reads of the raw files.
+    /// </summary>
+    inline detail::async_io& async_backend(void) const {
+        return this->directIo
+            ? detail::async_io::direct_instance()
+            : detail::async_io::instance();
+    }
+
+    /// <summary>
+    /// Checks that the region specified by <paramref name="origin" /> and
+    /// <paramref name="extent" /> is valid for the current time step and
+    /// answer its size in bytes.
+    /// </summary>
+    size_type check_region(const std::vector<std::uint32_t>& origin,
+        const std::vector<std::uint32_t>& extent,
+        size_type& frameSize) const;
+
+    /// <summary>
+    /// Invokes <paramref name="callback" /> with the offset in the file,
+    /// the offset in the output and the size of each contiguous run of
+    /// rows in the specified region, which must have been checked before.
+    /// </summary>
+    template<class F>
+    void for_each_run(const std::vector<std::uint32_t>& origin,
+        const std::vector<std::uint32_t>& extent, F&& callback) const;
+
+    /// <summary>
+    /// Opens the raw file of the current time step and makes sure that it
+    /// holds at least <paramref name="frameSize" /> bytes of data.
+    /// </summary>
+    file_type open_frame(const size_type frameSize) const;
+
+    /// <summary>
+    /// Opens the raw file of the given time step and answer the size of the
+    /// actual data in <paramref name="size" />.
+    /// </summary>
+    file_type open_raw(const time_step_type timeStep, size_type& size) const;
+
+    /// <summary>
+    /// Checks the size of the raw file <paramref name="path" /> against the
+    /// data offset and the scalar size and answer the size of the actual
+    /// data in bytes.
+    /// </summary>
+    size_type check_data_size(const string_type& path,
+        const std::uint64_t fileSize) const;
+
+    /// <summary>
+    /// Reads <paramref name="size" /> bytes of data from
+    /// <paramref name="file" /> and swaps the byte order as necessary.
+    /// </summary>
+    void read_frame(const file_type& file, void *dst,
+        const size_type size) const;
+
+    /// <summary>
+    /// Releases the pages of <paramref name="timeStep" /> from the page
+    /// cache unless its raw file is the one of the current time step. Files
+    /// that are not open in the file cache are skipped.
+    /// </summary>
+    void release(const time_step_type timeStep) const noexcept;
+
+    /// <summary>
+    /// Answer the path to the raw file of the given time step.
+    /// </summary>
+    inline string_type raw_file(const time_step_type timeStep) const {
+        auto retval = this->datInfo.multi_file_name(timeStep);
+        return this->datInfo.evaluate_path(retval);
+    }
+
+    /// <summary>
+    /// The expected access pattern, which is passed on to the OS.
+    /// </summary>
+    access_pattern accessPattern;
+
     /// <summary>
     /// Stores the current time step.
     /// </summary>
@@ -235,6 +1231,21 @@ private:
     /// The content from a dat file.
     /// </summary>
     info_type datInfo;
+
+    /// <summary>
+    /// Determines whether the raw files are opened for direct I/O.
+    /// </summary>
+    bool directIo;
+
+    /// <summary>
+    /// Keeps the most recently used raw files open.
+    /// </summary>
+    std::shared_ptr<file_cache_type> fileCache;
+
+    /// <summary>
+    /// Determines whether the size of a frame is derived from the geometry.
+    /// </summary>
+    bool strictGeometry;
 };
 
 DATRAW_NAMESPACE_END
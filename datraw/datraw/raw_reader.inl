@@ -1,87 +1,1037 @@
 ﻿// <copyright file="raw_reader.inl" company="Visualisierungsinstitut der Universität Stuttgart">
-// Copyright © 2017 - 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Copyright © 2017 - 2026 Visualisierungsinstitut der Universität Stuttgart.
 // Licensed under the MIT licence. See LICENCE file for details.
 // </copyright>
 // <author>Christoph Müller</author>
 
 
 /*
- * DATRAW_NAMESPACE::raw_reader<C>::read_current
+ * DATRAW_NAMESPACE::raw_reader<C>::map
+ */
+template<class C>
+DATRAW_NAMESPACE::frame_view DATRAW_NAMESPACE::raw_reader<C>::map(
+        const time_step_type timeStep) const {
+    this->check_time_step(timeStep);
+
+    size_type size;
+    auto file = this->open_raw(timeStep, size);
+    auto swap = this->datInfo.requires_byte_swap()
+        ? this->datInfo.scalar_size()
+        : 0;
+
+    if (this->directIo) {
+        return frame_view::read(*file, this->datInfo.data_offset(), size,
+            swap);
+    } else {
+        return frame_view::map(*file, this->datInfo.data_offset(), size,
+            swap, this->accessPattern);
+    }
+}
+
+
+/*
+ * DATRAW_NAMESPACE::raw_reader<C>::read
  */
 template<class C>
 typename DATRAW_NAMESPACE::raw_reader<C>::size_type
-DATRAW_NAMESPACE::raw_reader<C>::read_current(
+DATRAW_NAMESPACE::raw_reader<C>::read(const time_step_type timeStep,
         void *dst, const size_type cntDst) const {
-    if (this->curTimeStep >= this->datInfo.time_steps()) {
-        throw std::range_error("All time steps have been consumed already.");
+    this->check_time_step(timeStep);
+
+    size_type retval;
+    if (this->strictGeometry) {
+        // The size is known without touching the file system, so answer it
+        // right away if the caller cannot receive the data.
+        retval = this->datInfo.frame_size();
+        if ((dst == nullptr) || (cntDst < retval)) {
+            return retval;
+        }
+    }
+
+    auto file = this->open_raw(timeStep, retval);
+
+    // Read the data if possible.
+    if ((dst != nullptr) && (cntDst >= retval)) {
+        this->read_frame(file, dst, retval);
+    }
+
+    return retval;
+}
+
+
+/*
+ * DATRAW_NAMESPACE::raw_reader<C>::read
+ */
+template<class C>
+template<class A>
+std::vector<DATRAW_NAMESPACE::uint8, A>
+DATRAW_NAMESPACE::raw_reader<C>::read(const time_step_type timeStep,
+        const A& allocator) const {
+    static_assert(std::is_same<typename A::value_type,
+        datraw::uint8>::value, "The allocator must allocate bytes.");
+    this->check_time_step(timeStep);
+
+    size_type size;
+    auto file = this->open_raw(timeStep, size);
+
+    std::vector<datraw::uint8, A> retval(allocator);
+    retval.resize(size);
+    this->read_frame(file, retval.data(), size);
+
+    return retval;
+}
+
+
+/*
+ * DATRAW_NAMESPACE::raw_reader<C>::read
+ */
+template<class C>
+std::unique_ptr<DATRAW_NAMESPACE::uint8[]>
+DATRAW_NAMESPACE::raw_reader<C>::read(const time_step_type timeStep,
+        size_type& size) const {
+    this->check_time_step(timeStep);
+
+    auto file = this->open_raw(timeStep, size);
+
+    // Note that new[] does not initialise the bytes.
+    std::unique_ptr<datraw::uint8[]> retval(new datraw::uint8[size]);
+    this->read_frame(file, retval.get(), size);
+
+    return retval;
+}
+
+
+/*
+ * DATRAW_NAMESPACE::raw_reader<C>::read_next
+ */
+template<class C>
+std::vector<DATRAW_NAMESPACE::uint8>
+DATRAW_NAMESPACE::raw_reader<C>::read_next(void) const {
+    static const std::vector<DATRAW_NAMESPACE::uint8> EMPTY;
+    if (this->move_next()) {
+        return this->read_current();
+    } else {
+        return EMPTY;
+    }
+}
+
+
+/*
+ * DATRAW_NAMESPACE::raw_reader<C>::for_each_chunk
+ */
+template<class C>
+template<class F>
+typename DATRAW_NAMESPACE::raw_reader<C>::size_type
+DATRAW_NAMESPACE::raw_reader<C>::for_each_chunk(const size_type chunkSize,
+        F&& callback) const {
+    this->check_current();
+
+    size_type retval;
+    auto file = this->open_raw(this->curTimeStep, retval);
+    const auto offset = this->datInfo.data_offset();
+    const auto swap = this->datInfo.requires_byte_swap();
+    const auto ss = this->datInfo.scalar_size();
+
+    // Make sure that chunks hold full elements or at least full scalars.
+    auto unit = this->datInfo.element_size();
+    if (unit == 0) {
+        unit = (this->datInfo.format() != scalar_type::raw) ? ss : 1;
     }
+    const auto size = (std::min)((std::max)(chunkSize - chunkSize % unit,
+        unit), retval);
 
-    // Compute the path to the current time step.
-    auto path = this->datInfo.multi_file_name(this->curTimeStep);
-    path = this->datInfo.evaluate_path(path);
+    std::unique_ptr<datraw::uint8[]> buffer(new datraw::uint8[size]);
+
+    for (size_type o = 0; o < retval; o += size) {
+        const auto cnt = (std::min)(size, retval - o);
+        file->read(offset + o, buffer.get(), cnt);
+
+        if (swap) {
+            DATRAW_NAMESPACE::swap_byte_order(ss, buffer.get(), cnt / ss);
+        }
+
+        callback(static_cast<const void *>(buffer.get()), cnt, o);
+    }
+
+    return retval;
+}
+
+
+/*
+ * DATRAW_NAMESPACE::raw_reader<C>::read_as
+ */
+template<class C>
+template<class T>
+typename DATRAW_NAMESPACE::raw_reader<C>::size_type
+DATRAW_NAMESPACE::raw_reader<C>::read_as(const time_step_type timeStep,
+        T *dst, const size_type cntDst) const {
+    this->check_time_step(timeStep);
+
+    const auto format = this->datInfo.format();
+    const auto ss = this->datInfo.scalar_size();
+    if (ss == 0) {
+        throw std::runtime_error("Raw data of unknown type cannot be "
+            "converted.");
+    }
+
+    size_type size;
+    auto file = this->open_raw(timeStep, size);
+    const auto retval = size / ss;
+
+    if ((dst == nullptr) || (cntDst < retval)) {
+        return retval;
+    }
+
+    const auto offset = this->datInfo.data_offset();
+    const auto swap = this->datInfo.requires_byte_swap();
+
+    if (format == scalar_type_v<T>) {
+        // There is nothing to convert, so we read directly into the output
+        // and swap each block while it is still in the cache.
+        const auto block = staging_block_size() / ss;
+        for (size_type i = 0; i < retval; i += block) {
+            const auto cnt = (std::min)(block, retval - i);
+            file->read(offset + i * ss, dst + i, cnt * ss);
+            if (swap) {
+                DATRAW_NAMESPACE::swap_byte_order(ss, dst + i, cnt);
+            }
+        }
+
+    } else {
+        // Read blocks into the staging buffer and convert them into the
+        // output from there.
+        const auto block = staging_block_size() / ss;
+        std::unique_ptr<datraw::uint8[]> buffer(
+            new datraw::uint8[block * ss]);
+
+        for (size_type i = 0; i < retval; i += block) {
+            const auto cnt = (std::min)(block, retval - i);
+            file->read(offset + i * ss, buffer.get(), cnt * ss);
+            if (swap) {
+                DATRAW_NAMESPACE::swap_byte_order(ss, buffer.get(), cnt);
+            }
+            DATRAW_NAMESPACE::visit_scalar(format, [&](const auto tag) {
+                typedef typename decltype(tag)::type source_type;
+                auto src = reinterpret_cast<const source_type *>(
+                    buffer.get());
+                DATRAW_NAMESPACE::convert<T>(src, src + cnt, dst + i);
+            });
+        }
+    }
+
+    return retval;
+}
+
+
+/*
+ * DATRAW_NAMESPACE::raw_reader<C>::read_as
+ */
+template<class C>
+template<class S, class T>
+typename DATRAW_NAMESPACE::raw_reader<C>::size_type
+DATRAW_NAMESPACE::raw_reader<C>::read_as(const time_step_type timeStep,
+        const lookup_table<S, T>& table, T *dst,
+        const size_type cntDst) const {
+    this->check_time_step(timeStep);
 
-    // Get the required buffer size.
-    ifstream_type stream(path, ifstream_type::ate | ifstream_type::binary);
-    if (!stream.good()) {
+    if (this->datInfo.format() != scalar_type_v<S>) {
+        throw std::runtime_error("The format of the data set does not match "
+            "the source type of the lookup table.");
+    }
+
+    size_type size;
+    auto file = this->open_raw(timeStep, size);
+    const auto retval = size / sizeof(S);
+
+    if ((dst == nullptr) || (cntDst < retval)) {
+        return retval;
+    }
+
+    const auto offset = this->datInfo.data_offset();
+    const auto swap = this->datInfo.requires_byte_swap();
+    const auto block = staging_block_size() / sizeof(S);
+    std::vector<S> buffer(block);
+
+    for (size_type i = 0; i < retval; i += block) {
+        const auto cnt = (std::min)(block, retval - i);
+        file->read(offset + i * sizeof(S), buffer.data(), cnt * sizeof(S));
+        if (swap) {
+            DATRAW_NAMESPACE::swap_byte_order(sizeof(S), buffer.data(), cnt);
+        }
+        table.apply(buffer.data(), buffer.data() + cnt, dst + i);
+    }
+
+    return retval;
+}
+
+
+/*
+ * DATRAW_NAMESPACE::raw_reader<C>::read_async
+ */
+template<class C>
+std::future<typename DATRAW_NAMESPACE::raw_reader<C>::size_type>
+DATRAW_NAMESPACE::raw_reader<C>::read_async(const time_step_type timeStep,
+        void *dst, const size_type cntDst) const {
+    this->check_time_step(timeStep);
+
+    size_type size;
+    auto file = this->open_raw(timeStep, size);
+    if ((dst == nullptr) || (cntDst < size)) {
+        dst = nullptr;
+    }
+
+    std::future<size_type> retval;
+    auto request = this->async_request(std::move(file), dst, size, retval);
+    if (dst != nullptr) {
+        request.reads.push_back({ this->datInfo.data_offset(), dst, size });
+    }
+
+    this->async_backend().submit(std::move(request));
+    return retval;
+}
+
+
+/*
+ * DATRAW_NAMESPACE::raw_reader<C>::read_range_async
+ */
+template<class C>
+std::vector<std::future<typename DATRAW_NAMESPACE::raw_reader<C>::size_type>>
+DATRAW_NAMESPACE::raw_reader<C>::read_range_async(const time_step_type first,
+        const time_step_type count, void *const *dst,
+        const size_type *cntDst) const {
+    std::vector<std::future<size_type>> retval(static_cast<size_type>(count));
+
+    if (count > 0) {
+        this->check_time_step(first);
+        this->check_time_step(first + count - 1);
+        assert(dst != nullptr);
+        assert(cntDst != nullptr);
+
+        std::vector<detail::async_io::request_type> requests;
+        requests.reserve(retval.size());
+
+        for (size_type i = 0; i < retval.size(); ++i) {
+            size_type size;
+            auto file = this->open_raw(first + i, size);
+            auto d = ((dst[i] != nullptr) && (cntDst[i] >= size))
+                ? dst[i]
+                : nullptr;
+
+            requests.push_back(this->async_request(std::move(file), d, size,
+                retval[i]));
+            if (d != nullptr) {
+                requests.back().reads.push_back({ this->datInfo.data_offset(),
+                    d, size });
+            }
+        }
+
+        this->async_backend().submit(std::move(requests));
+    }
+
+    return retval;
+}
+
+
+/*
+ * DATRAW_NAMESPACE::raw_reader<C>::read_range
+ */
+template<class C>
+std::vector<typename DATRAW_NAMESPACE::raw_reader<C>::size_type>
+DATRAW_NAMESPACE::raw_reader<C>::read_range(const time_step_type first,
+        const time_step_type count, void *const *dst,
+        const size_type *cntDst, const size_type concurrency) const {
+    std::vector<size_type> retval(static_cast<size_type>(count));
+
+    if (count > 0) {
+        this->check_time_step(first);
+        this->check_time_step(first + count - 1);
+        assert(dst != nullptr);
+        assert(cntDst != nullptr);
+
+        detail::parallel_for(retval.size(), concurrency,
+                [&](const size_type i) {
+            retval[i] = this->read(first + i, dst[i], cntDst[i]);
+        });
+    }
+
+    return retval;
+}
+
+
+/*
+ * DATRAW_NAMESPACE::raw_reader<C>::read_range
+ */
+template<class C>
+std::vector<std::vector<DATRAW_NAMESPACE::uint8>>
+DATRAW_NAMESPACE::raw_reader<C>::read_range(const time_step_type first,
+        const time_step_type count, const size_type concurrency) const {
+    std::vector<std::vector<datraw::uint8>> retval(
+        static_cast<size_type>(count));
+
+    if (count > 0) {
+        this->check_time_step(first);
+        this->check_time_step(first + count - 1);
+
+        detail::parallel_for(retval.size(), concurrency,
+                [&](const size_type i) {
+            retval[i] = this->read(first + i);
+        });
+    }
+
+    return retval;
+}
+
+
+/*
+ * DATRAW_NAMESPACE::raw_reader<C>::read_time_range
+ */
+template<class C>
+typename DATRAW_NAMESPACE::raw_reader<C>::size_type
+DATRAW_NAMESPACE::raw_reader<C>::read_time_range(const time_step_type first,
+        const time_step_type count, void *dst, const size_type cntDst,
+        const size_type framePitch, const size_type concurrency) const {
+    if (count == 0) {
+        return 0;
+    }
+
+    this->check_time_step(first);
+    this->check_time_step(first + count - 1);
+
+    // Determine the size of all frames, which must fit into their slots.
+    std::vector<size_type> sizes(static_cast<size_type>(count));
+    for (size_type i = 0; i < sizes.size(); ++i) {
+        if (this->strictGeometry) {
+            sizes[i] = this->datInfo.frame_size();
+        } else {
+            this->open_raw(first + i, sizes[i]);
+        }
+    }
+
+    const auto pitch = (framePitch > 0)
+        ? framePitch
+        : *std::max_element(sizes.begin(), sizes.end());
+    for (size_type i = 0; i < sizes.size(); ++i) {
+        if (sizes[i] > pitch) {
+            std::stringstream msg;
+            msg << "Time step " << (first + i) << " comprises " << sizes[i]
+                << " bytes, which exceeds the frame pitch of " << pitch
+                << " bytes." << std::ends;
+            throw std::invalid_argument(msg.str());
+        }
+    }
+
+    const auto retval = (sizes.size() - 1) * pitch + sizes.back();
+    if ((dst == nullptr) || (cntDst < retval)) {
+        return retval;
+    }
+
+    auto output = static_cast<datraw::uint8 *>(dst);
+    detail::parallel_for(sizes.size(), concurrency,
+            [&](const size_type i) {
+        // The raw file might have changed since we determined the sizes, in
+        // which case the slot would not or not completely be written.
+        const auto size = this->read(first + i, output + i * pitch,
+            sizes[i]);
+        if (size != sizes[i]) {
+            std::stringstream msg;
+            msg << "Time step " << (first + i) << " comprises " << size
+                << " bytes instead of the expected " << sizes[i]
+                << " bytes." << std::ends;
+            throw std::runtime_error(msg.str());
+        }
+    });
+
+    return retval;
+}
+
+
+/*
+ * DATRAW_NAMESPACE::raw_reader<C>::read_region
+ */
+template<class C>
+typename DATRAW_NAMESPACE::raw_reader<C>::size_type
+DATRAW_NAMESPACE::raw_reader<C>::read_region(
+        const std::vector<std::uint32_t>& origin,
+        const std::vector<std::uint32_t>& extent,
+        void *dst, const size_type cntDst) const {
+    size_type frameSize;
+    const auto retval = this->check_region(origin, extent, frameSize);
+
+    if ((dst == nullptr) || (cntDst < retval) || (retval == 0)) {
+        return retval;
+    }
+
+    auto file = this->open_frame(frameSize);
+    auto output = static_cast<DATRAW_NAMESPACE::uint8 *>(dst);
+    this->for_each_run(origin, extent, [&](const std::uint64_t offset,
+            const size_type dstOffset, const size_type size) {
+        file->read(offset, output + dstOffset, size);
+    });
+
+    if (this->datInfo.requires_byte_swap()) {
+        auto ss = this->datInfo.scalar_size();
+        DATRAW_NAMESPACE::swap_byte_order(ss, dst, retval / ss);
+    }
+
+    return retval;
+}
+
+
+/*
+ * DATRAW_NAMESPACE::raw_reader<C>::read_region_async
+ */
+template<class C>
+std::future<typename DATRAW_NAMESPACE::raw_reader<C>::size_type>
+DATRAW_NAMESPACE::raw_reader<C>::read_region_async(
+        const std::vector<std::uint32_t>& origin,
+        const std::vector<std::uint32_t>& extent,
+        void *dst, const size_type cntDst) const {
+    size_type frameSize;
+    const auto size = this->check_region(origin, extent, frameSize);
+
+    if ((dst == nullptr) || (cntDst < size) || (size == 0)) {
+        std::promise<size_type> promise;
+        promise.set_value(size);
+        return promise.get_future();
+    }
+
+    std::future<size_type> retval;
+    auto request = this->async_request(this->open_frame(frameSize), dst,
+        size, retval);
+    auto output = static_cast<DATRAW_NAMESPACE::uint8 *>(dst);
+    this->for_each_run(origin, extent, [&](const std::uint64_t offset,
+            const size_type dstOffset, const size_type cnt) {
+        request.reads.push_back({ offset, output + dstOffset, cnt });
+    });
+
+    this->async_backend().submit(std::move(request));
+    return retval;
+}
+
+
+/*
+ * DATRAW_NAMESPACE::raw_reader<C>::read_slice
+ */
+template<class C>
+typename DATRAW_NAMESPACE::raw_reader<C>::size_type
+DATRAW_NAMESPACE::raw_reader<C>::read_slice(const std::uint32_t axis,
+        const std::uint32_t index, void *dst, const size_type cntDst) const {
+    std::vector<std::uint32_t> resolution;
+    const auto elementSize = this->check_row_access(resolution);
+
+    if (axis >= resolution.size()) {
         std::stringstream msg;
-        msg << "The raw file \"" << detail::narrow_string(path)
-            << "\" could not be opened." << std::ends;
+        msg << "The axis " << axis << " does not exist in a grid with "
+            << resolution.size() << " dimension(s)." << std::ends;
         throw std::invalid_argument(msg.str());
     }
-    auto retval = static_cast<size_t>(stream.tellg());
+    if (index >= resolution[axis]) {
+        std::stringstream msg;
+        msg << "The slice " << index << " exceeds the resolution of "
+            << resolution[axis] << " on axis " << axis << "." << std::ends;
+        throw std::invalid_argument(msg.str());
+    }
+
+    // The slice consists of 'outer' pieces of 'inner' contiguous elements,
+    // which are 'stride' bytes apart in the file.
+    size_type inner = 1;
+    size_type outer = 1;
+    for (std::uint32_t i = 0; i < axis; ++i) {
+        inner *= resolution[i];
+    }
+    for (auto i = axis + 1; i < resolution.size(); ++i) {
+        outer *= resolution[i];
+    }
+
+    const auto pieceSize = inner * elementSize;
+    const auto stride = pieceSize * resolution[axis];
+    const auto retval = pieceSize * outer;
+
+    if ((dst == nullptr) || (cntDst < retval) || (retval == 0)) {
+        return retval;
+    }
+
+    auto file = this->open_frame(stride * outer);
+    const auto offset = this->datInfo.data_offset()
+        + static_cast<std::uint64_t>(index) * pieceSize;
+    auto output = static_cast<DATRAW_NAMESPACE::uint8 *>(dst);
+
+    if ((outer == 1) || (stride == pieceSize)) {
+        // The slice is contiguous in the file.
+        file->read(offset, output, retval);
+
+    } else if (stride - pieceSize > raw_reader::gather_gap_size()) {
+        // The gaps are too large to read them, so read each piece directly.
+        // Note that each piece is at least a whole row in this case.
+        for (size_type o = 0; o < outer; ++o) {
+            file->read(offset + o * stride, output + o * pieceSize, pieceSize);
+        }
+
+    } else {
+        // Read blocks of multiple pieces including the gaps between them
+        // and gather the pieces in memory.
+        const auto blockSize = (std::max)(raw_reader::gather_block_size(),
+            stride);
+        const auto piecesPerBlock = (blockSize - pieceSize) / stride + 1;
+        std::vector<DATRAW_NAMESPACE::uint8> block(
+            (piecesPerBlock - 1) * stride + pieceSize);
+
+        for (size_type o = 0; o < outer; o += piecesPerBlock) {
+            const auto pieces = (std::min)(piecesPerBlock, outer - o);
+            file->read(offset + o * stride, block.data(),
+                (pieces - 1) * stride + pieceSize);
+
+            for (size_type p = 0; p < pieces; ++p) {
+                std::memcpy(output + (o + p) * pieceSize,
+                    block.data() + p * stride,
+                    pieceSize);
+            }
+        }
+    }
+
+    if (this->datInfo.requires_byte_swap()) {
+        auto ss = this->datInfo.scalar_size();
+        DATRAW_NAMESPACE::swap_byte_order(ss, dst, retval / ss);
+    }
+
+    return retval;
+}
+
+
+/*
+ * DATRAW_NAMESPACE::raw_reader<C>::read_pitched
+ */
+template<class C>
+typename DATRAW_NAMESPACE::raw_reader<C>::size_type
+DATRAW_NAMESPACE::raw_reader<C>::read_pitched(const size_type rowPitch,
+        const size_type slicePitch, void *dst, const size_type cntDst) const {
+    std::vector<std::uint32_t> resolution;
+    const auto elementSize = this->check_row_access(resolution);
+
+    // The frame consists of 'slices' slices of 'rows' rows each.
+    const auto rowSize = (resolution.empty() ? 0 : resolution[0])
+        * elementSize;
+    const size_type rows = (resolution.size() > 1) ? resolution[1] : 1;
+    size_type slices = 1;
+    for (std::size_t i = 2; i < resolution.size(); ++i) {
+        slices *= resolution[i];
+    }
+
+    const auto dstRowPitch = (rowPitch > 0) ? rowPitch : rowSize;
+    if (dstRowPitch < rowSize) {
+        std::stringstream msg;
+        msg << "The row pitch of " << rowPitch << " bytes is smaller than a "
+            "row of " << rowSize << " bytes." << std::ends;
+        throw std::invalid_argument(msg.str());
+    }
+
+    const auto dstSlicePitch = (slicePitch > 0)
+        ? slicePitch
+        : rows * dstRowPitch;
+    if (dstSlicePitch < rows * dstRowPitch) {
+        std::stringstream msg;
+        msg << "The slice pitch of " << slicePitch << " bytes is smaller "
+            "than " << rows << " row(s) of " << dstRowPitch << " bytes."
+            << std::ends;
+        throw std::invalid_argument(msg.str());
+    }
+
+    const auto cntRows = rows * slices;
+    const auto retval = ((cntRows == 0) || (rowSize == 0))
+        ? 0
+        : (slices - 1) * dstSlicePitch + (rows - 1) * dstRowPitch + rowSize;
+
+    if ((dst == nullptr) || (cntDst < retval) || (retval == 0)) {
+        return retval;
+    }
+
+    auto file = this->open_frame(rowSize * cntRows);
+    const auto offset = this->datInfo.data_offset();
+    auto output = static_cast<DATRAW_NAMESPACE::uint8 *>(dst);
+    const auto swap = this->datInfo.requires_byte_swap();
+    const auto scalarSize = this->datInfo.scalar_size();
+
+    // Answer the location of row 'r' in the destination.
+    auto row = [&](const size_type r) {
+        return output + (r / rows) * dstSlicePitch + (r % rows) * dstRowPitch;
+    };
+
+    if ((dstRowPitch == rowSize) && (dstSlicePitch == rows * rowSize)) {
+        // The destination is densely packed.
+        file->read(offset, output, retval);
+        if (swap) {
+            DATRAW_NAMESPACE::swap_byte_order(scalarSize, output,
+                retval / scalarSize);
+        }
+
+    } else if (rowSize > raw_reader::gather_gap_size()) {
+        // The rows are large enough to be read directly. If the rows are
+        // packed within a slice, read the whole slice at once.
+        const auto packed = (dstRowPitch == rowSize);
+        const auto step = packed ? rows : 1;
+        const auto size = step * rowSize;
+
+        for (size_type r = 0; r < cntRows; r += step) {
+            auto d = row(r);
+            file->read(offset + r * rowSize, d, size);
+            if (swap) {
+                DATRAW_NAMESPACE::swap_byte_order(scalarSize, d,
+                    size / scalarSize);
+            }
+        }
+
+    } else {
+        // Read blocks of multiple rows and scatter them in memory.
+        const auto rowsPerBlock = (std::max)(size_type(1),
+            raw_reader::gather_block_size() / rowSize);
+        std::vector<DATRAW_NAMESPACE::uint8> block(
+            (std::min)(rowsPerBlock, cntRows) * rowSize);
+
+        for (size_type r = 0; r < cntRows; r += rowsPerBlock) {
+            const auto cnt = (std::min)(rowsPerBlock, cntRows - r);
+            file->read(offset + r * rowSize, block.data(), cnt * rowSize);
+
+            for (size_type i = 0; i < cnt; ++i) {
+                auto s = block.data() + i * rowSize;
+                if (swap) {
+                    DATRAW_NAMESPACE::copy_swap_byte_order(scalarSize, s,
+                        row(r + i), rowSize / scalarSize);
+                } else {
+                    std::memcpy(row(r + i), s, rowSize);
+                }
+            }
+        }
+    }
+
+    return retval;
+}
+
+
+/*
+ * DATRAW_NAMESPACE::raw_reader<C>::check_time_step
+ */
+template<class C>
+void DATRAW_NAMESPACE::raw_reader<C>::check_time_step(
+        const time_step_type timeStep) const {
+    if (timeStep >= this->datInfo.time_steps()) {
+        std::stringstream msg;
+        msg << "The time step " << timeStep << " does not exist in a data "
+            "set with " << this->datInfo.time_steps() << " time step(s)."
+            << std::ends;
+        throw std::range_error(msg.str());
+    }
+}
+
+
+/*
+ * DATRAW_NAMESPACE::raw_reader<C>::check_row_access
+ */
+template<class C>
+typename DATRAW_NAMESPACE::raw_reader<C>::size_type
+DATRAW_NAMESPACE::raw_reader<C>::check_row_access(
+        std::vector<std::uint32_t>& resolution) const {
+    this->check_current();
+
+    switch (this->datInfo.grid_type()) {
+        case DATRAW_NAMESPACE::grid_type::cartesian:
+        case DATRAW_NAMESPACE::grid_type::rectilinear:
+            break;
+
+        default:
+            throw std::runtime_error("Only Cartesian and rectilinear grids "
+                "are organised in rows which parts can be read from.");
+    }
+
+    const auto retval = this->datInfo.element_size();
+    if (retval == 0) {
+        throw std::runtime_error("Parts of a frame can only be read if the "
+            "size of an element is known.");
+    }
+
+    resolution = this->datInfo.resolution();
+    return retval;
+}
+
 
+/*
+ * DATRAW_NAMESPACE::raw_reader<C>::check_data_size
+ */
+template<class C>
+typename DATRAW_NAMESPACE::raw_reader<C>::size_type
+DATRAW_NAMESPACE::raw_reader<C>::check_data_size(const string_type& path,
+        const std::uint64_t fileSize) const {
     // Check and account for the data offset.
     auto offset = this->datInfo.data_offset();
-    if (offset >= retval) {
+    if (offset >= fileSize) {
         std::stringstream msg;
         msg << "The data offset " << offset << " is larger than the total "
-            << retval << " byte(s) in \"" << detail::narrow_string(path)
+            << fileSize << " byte(s) in \"" << detail::narrow_string(path)
             << "\"." << std::ends;
         throw std::invalid_argument(msg.str());
+    }
 
-    } else {
-        retval -= static_cast<std::size_t>(offset);
+    auto retval = static_cast<size_type>(fileSize - offset);
+
+    if (this->strictGeometry) {
+        // Only read the volume itself and ignore anything after it.
+        const auto frameSize = this->datInfo.frame_size();
+        if (retval < frameSize) {
+            std::stringstream msg;
+            msg << "The raw file \"" << detail::narrow_string(path)
+                << "\" contains " << retval << " bytes of data, but "
+                << frameSize << " bytes are required for the specified "
+                << "resolution." << std::ends;
+            throw std::invalid_argument(msg.str());
+        }
+
+        retval = frameSize;
     }
 
-    // TODO: for cartesian and rectilinear grids, we could check the expected
-    // size of the data here.
+    // If we need to swap the byte order, the data must consist of full
+    // scalars.
+    if (this->datInfo.requires_byte_swap()) {
+        assert(this->datInfo.format() != scalar_type::raw);
+        auto ss = this->datInfo.scalar_size();
+        if ((retval % ss) != 0) {
+            std::stringstream msg;
+            msg << "The raw file \"" << detail::narrow_string(path)
+                << "\" contains " << retval << " bytes, which is not "
+                << "divisible by the size of a scalar (" << ss << ")."
+                << std::ends;
+            throw std::invalid_argument(msg.str());
+        }
+    }
+
+    return retval;
+}
 
-    // Read the data if possible.
-    if ((dst != nullptr) && (cntDst >= retval)) {
-        stream.seekg(offset, ifstream_type::beg);
-        stream.read(static_cast<char *>(dst), cntDst);
-
-        if (this->datInfo.requires_byte_swap()) {
-            assert(this->datInfo.format() != scalar_type::raw);
-            auto ss = this->datInfo.scalar_size();
-            if ((retval % ss) != 0) {
-                std::stringstream msg;
-                msg << "The raw file \"" << detail::narrow_string(path)
-                    << "\" contains " << retval << " bytes, which is not "
-                    << "divisible by the size of a scalar (" << ss << ")."
-                    << std::ends;
-                throw std::invalid_argument(msg.str());
-            }
 
-            DATRAW_NAMESPACE::swap_byte_order(ss, dst, retval / ss);
+/*
+ * DATRAW_NAMESPACE::raw_reader<C>::open_frame
+ */
+template<class C>
+typename DATRAW_NAMESPACE::raw_reader<C>::file_type
+DATRAW_NAMESPACE::raw_reader<C>::open_frame(const size_type frameSize) const {
+    size_type size;
+    auto retval = this->open_raw(this->curTimeStep, size);
+
+    if (size < frameSize) {
+        std::stringstream msg;
+        msg << "The raw file \"" << detail::narrow_string(
+            this->raw_file(this->curTimeStep))
+            << "\" is too small for the specified resolution." << std::ends;
+        throw std::invalid_argument(msg.str());
+    }
+
+    return retval;
+}
+
+
+/*
+ * DATRAW_NAMESPACE::raw_reader<C>::open_raw
+ */
+template<class C>
+typename DATRAW_NAMESPACE::raw_reader<C>::file_type
+DATRAW_NAMESPACE::raw_reader<C>::open_raw(const time_step_type timeStep,
+        size_type& size) const {
+    auto path = this->raw_file(timeStep);
+    std::uint64_t fileSize;
+    auto retval = this->fileCache->open(path, this->directIo, fileSize);
+    size = this->check_data_size(path, fileSize);
+    retval->advise(this->accessPattern, this->datInfo.data_offset(), size);
+    return retval;
+}
+
+
+/*
+ * DATRAW_NAMESPACE::raw_reader<C>::release
+ */
+template<class C>
+void DATRAW_NAMESPACE::raw_reader<C>::release(
+        const time_step_type timeStep) const noexcept {
+    try {
+        if (timeStep >= this->datInfo.time_steps()) {
+            return;
         }
+
+        // If all time steps are in the same file or if we only skipped
+        // within the current file, we must keep the pages.
+        auto path = this->raw_file(timeStep);
+        if ((this->curTimeStep < this->datInfo.time_steps())
+                && (path == this->raw_file(this->curTimeStep))) {
+            return;
+        }
+
+        // Opening the file only for giving the hint is not worth a system
+        // call, so we only discard files that are still open in the cache.
+        std::uint64_t size;
+        auto file = this->fileCache->find(path, this->directIo, size);
+        if (file != nullptr) {
+            file->discard(0, size);
+        }
+    } catch (...) {
+        // This is only a hint, so we do not care if it fails.
+    }
+}
+
+
+/*
+ * DATRAW_NAMESPACE::raw_reader<C>::read_frame
+ */
+template<class C>
+void DATRAW_NAMESPACE::raw_reader<C>::read_frame(const file_type& file,
+        void *dst, const size_type size) const {
+    file->read(this->datInfo.data_offset(), dst, size);
+
+    if (this->datInfo.requires_byte_swap()) {
+        auto ss = this->datInfo.scalar_size();
+        DATRAW_NAMESPACE::swap_byte_order(ss, dst, size / ss);
+    }
+}
+
+
+/*
+ * DATRAW_NAMESPACE::raw_reader<C>::async_request
+ */
+template<class C>
+DATRAW_NAMESPACE::detail::async_io::request_type
+DATRAW_NAMESPACE::raw_reader<C>::async_request(file_type&& file,
+        void *dst, const size_type size,
+        std::future<size_type>& future) const {
+    auto promise = std::make_shared<std::promise<size_type>>();
+    future = promise->get_future();
+
+    const auto swap = ((dst != nullptr) && this->datInfo.requires_byte_swap())
+        ? this->datInfo.scalar_size()
+        : 0;
+
+    // Note that the completion must not reference the reader, because the
+    // reader might have been destroyed once the read completes.
+    detail::async_io::request_type retval;
+    retval.source = std::move(file);
+    retval.completion = [promise, size](std::exception_ptr e) {
+        if (e) {
+            promise->set_exception(e);
+        } else {
+            promise->set_value(size);
+        }
+    };
+
+    if (swap > 0) {
+        // Swap each segment as soon as it has been read rather than the
+        // whole frame at the end, which distributes the work over the
+        // threads of the backend.
+        retval.process = [swap](void *data, const std::size_t cnt) {
+            DATRAW_NAMESPACE::swap_byte_order(swap, data, cnt / swap);
+        };
     }
 
-    stream.close();
     return retval;
 }
 
 
 /*
- * DATRAW_NAMESPACE::raw_reader<C>::read_next
+ * DATRAW_NAMESPACE::raw_reader<C>::check_region
  */
 template<class C>
-std::vector<DATRAW_NAMESPACE::uint8>
-DATRAW_NAMESPACE::raw_reader<C>::read_next(void) const {
-    static const std::vector<DATRAW_NAMESPACE::uint8> EMPTY;
-    if (this->move_next()) {
-        return this->read_current();
-    } else {
-        return EMPTY;
+typename DATRAW_NAMESPACE::raw_reader<C>::size_type
+DATRAW_NAMESPACE::raw_reader<C>::check_region(
+        const std::vector<std::uint32_t>& origin,
+        const std::vector<std::uint32_t>& extent,
+        size_type& frameSize) const {
+    std::vector<std::uint32_t> resolution;
+    const auto elementSize = this->check_row_access(resolution);
+
+    if (resolution.empty() || (origin.size() != resolution.size())
+            || (extent.size() != resolution.size())) {
+        std::stringstream msg;
+        msg << "The origin and the extent of the region must be specified "
+            "for all of the " << resolution.size() << " dimensions."
+            << std::ends;
+        throw std::invalid_argument(msg.str());
+    }
+
+    auto retval = elementSize;
+    frameSize = elementSize;
+    for (std::size_t i = 0; i < resolution.size(); ++i) {
+        if (static_cast<std::uint64_t>(origin[i]) + extent[i]
+                > resolution[i]) {
+            std::stringstream msg;
+            msg << "The region exceeds the resolution of " << resolution[i]
+                << " on axis " << i << "." << std::ends;
+            throw std::invalid_argument(msg.str());
+        }
+
+        retval *= extent[i];
+        frameSize *= resolution[i];
+    }
+
+    return retval;
+}
+
+
+/*
+ * DATRAW_NAMESPACE::raw_reader<C>::for_each_run
+ */
+template<class C>
+template<class F>
+void DATRAW_NAMESPACE::raw_reader<C>::for_each_run(
+        const std::vector<std::uint32_t>& origin,
+        const std::vector<std::uint32_t>& extent,
+        F&& callback) const {
+    const auto elementSize = this->datInfo.element_size();
+    const auto resolution = this->datInfo.resolution();
+    auto size = elementSize;
+    for (auto e : extent) {
+        size *= e;
+    }
+
+    // Enumerate all rows of the region in the order they are stored in the
+    // file. The first dimension is formed by the contiguous rows, so we
+    // only need to iterate over the other ones.
+    const auto dataOffset = this->datInfo.data_offset();
+    const auto rowSize = extent[0] * elementSize;
+    const auto rows = size / rowSize;
+    std::vector<std::uint32_t> index(resolution.size(), 0);
+
+    size_type output = 0;
+    std::uint64_t runBegin = 0;
+    size_type runSize = 0;
+
+    for (std::size_t r = 0; r < rows; ++r) {
+        std::uint64_t element = 0;
+        for (auto i = resolution.size() - 1; i > 0; --i) {
+            element += origin[i] + index[i];
+            element *= resolution[i - 1];
+        }
+        element += origin[0];
+
+        const auto rowBegin = dataOffset + element * elementSize;
+        if ((runSize > 0) && (runBegin + runSize == rowBegin)) {
+            // The row directly follows the current run in the file, so we can
+            // read it with the same call.
+            runSize += rowSize;
+
+        } else {
+            // Flush the current run and start a new one at this row.
+            if (runSize > 0) {
+                callback(runBegin, output, runSize);
+            }
+            output += runSize;
+            runBegin = rowBegin;
+            runSize = rowSize;
+        }
+
+        // Advance to the next row.
+        for (std::size_t i = 1; i < index.size(); ++i) {
+            if (++index[i] < extent[i]) {
+                break;
+            }
+            index[i] = 0;
+        }
+    }
+
+    if (runSize > 0) {
+        callback(runBegin, output, runSize);
     }
 }
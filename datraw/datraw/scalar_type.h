@@ -1,5 +1,5 @@
 ﻿// <copyright file="scalar_type.h" company="Visualisierungsinstitut der Universität Stuttgart">
-// Copyright © 2017 - 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Copyright © 2017 - 2026 Visualisierungsinstitut der Universität Stuttgart.
 // Licensed under the MIT licence. See LICENCE file for details.
 // </copyright>
 // <author>Christoph Müller</author>
@@ -152,6 +152,28 @@ inline constexpr std::size_t get_scalar_size(
     return 0;
 }
 
+/// <summary>
+/// Answer the position of the given scalar type in the
+/// <see cref="scalar_type_list" /> above.
+/// </summary>
+template<scalar_type T, scalar_type... Ts>
+inline constexpr std::size_t get_scalar_index(scalar_type_list_t<T, Ts...>,
+        const scalar_type type) noexcept {
+    return (type == T)
+        ? 0
+        : 1 + get_scalar_index(scalar_type_list_t<Ts...>(), type);
+}
+
+/// <summary>
+/// Recursion stop for <see cref="get_scalar_index" />, which will
+/// return 0 such that an unknown type yields the length of the list.
+/// </summary>
+inline constexpr std::size_t get_scalar_index(
+        detail::scalar_type_list_t<>,
+        const scalar_type) noexcept {
+    return 0;
+}
+
 DATRAW_DETAIL_NAMESPACE_END
 
 
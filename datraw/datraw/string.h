@@ -1,5 +1,5 @@
 ﻿// <copyright file="string.h" company="Visualisierungsinstitut der Universität Stuttgart">
-// Copyright © 2017 - 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Copyright © 2017 - 2026 Visualisierungsinstitut der Universität Stuttgart.
 // Licensed under the MIT licence. See LICENCE file for details.
 // </copyright>
 // <author>Christoph Müller</author>
@@ -11,6 +11,7 @@
 #include <algorithm>
 #if (!defined(__GNUC__) || (__GNUC__ >= 5))
 #include <codecvt>
+#include <locale>
 #endif /* (!defined(__GNUC__) || (__GNUC__ >= 5)) */
 #include <cctype>
 #include <cstdio>
@@ -1,5 +1,5 @@
 ﻿// <copyright file="string.inl" company="Visualisierungsinstitut der Universität Stuttgart">
-// Copyright © 2020 - 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Copyright © 2020 - 2026 Visualisierungsinstitut der Universität Stuttgart.
 // Licensed under the MIT licence. See LICENCE file for details.
 // </copyright>
 // <author>Christoph Müller</author>
@@ -78,7 +78,9 @@ std::wstring DATRAW_DETAIL_NAMESPACE::format(const std::wstring& fmt,
  */
 std::string DATRAW_DETAIL_NAMESPACE::narrow_string(const std::wstring& str) {
 #if (!defined(__GNUC__) || (__GNUC__ >= 5))
-    static std::wstring_convert<std::codecvt_utf8<wchar_t>> cvt;
+    // Note: the converter is stateful and must not be shared between threads
+    // as paths are converted from the concurrent read paths.
+    std::wstring_convert<std::codecvt_utf8<wchar_t>> cvt;
     return cvt.to_bytes(str);
 #else /* (!defined(__GNUC__) || (__GNUC__ >= 5)) */
     std::string retval;
@@ -96,7 +98,9 @@ std::string DATRAW_DETAIL_NAMESPACE::narrow_string(const std::wstring& str) {
  */
 std::wstring DATRAW_DETAIL_NAMESPACE::widen_string(const std::string& str) {
 #if (!defined(__GNUC__) || (__GNUC__ >= 5))
-    static std::wstring_convert<std::codecvt_utf8<wchar_t>> cvt;
+    // Note: the converter is stateful and must not be shared between threads
+    // as paths are converted from the concurrent read paths.
+    std::wstring_convert<std::codecvt_utf8<wchar_t>> cvt;
     return cvt.from_bytes(str);
 #else /* (!defined(__GNUC__) || (__GNUC__ >= 5)) */
     std::wstring retval;
@@ -0,0 +1,133 @@
+﻿// <copyright file="thread_pool.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2026 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_DATRAW_THREAD_POOL_H)
+#define _DATRAW_THREAD_POOL_H
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "datraw/abi.h"
+
+
+DATRAW_DETAIL_NAMESPACE_BEGIN
+
+/// <summary>
+/// A fixed set of threads executing tasks in the order of their submission.
+/// </summary>
+/// <remarks>
+/// <para>The threads are created once and live as long as the pool, ie
+/// submitting work does not incur the cost of creating threads.</para>
+/// <para>The class is thread-safe.</para>
+/// </remarks>
+class thread_pool final {
+
+public:
+
+    /// <summary>
+    /// The type to express the number of threads.
+    /// </summary>
+    typedef std::size_t size_type;
+
+    /// <summary>
+    /// The type of a task executed by the pool.
+    /// </summary>
+    /// <remarks>
+    /// Tasks should not throw. If they do, the exception is discarded.
+    /// </remarks>
+    typedef std::function<void(void)> task_type;
+
+    /// <summary>
+    /// Answer the instance shared by all computations, which has one thread
+    /// per hardware thread.
+    /// </summary>
+    /// <returns>The process-wide instance.</returns>
+    static inline thread_pool& instance(void) {
+        static thread_pool retval;
+        return retval;
+    }
+
+    /// <summary>
+    /// Initialises a new instance.
+    /// </summary>
+    /// <param name="threads">The number of threads in the pool. If this is
+    /// zero, the number of hardware threads is used.</param>
+    /// <exception cref="std::system_error">If the threads could not be
+    /// created.</exception>
+    inline explicit thread_pool(const size_type threads = 0);
+
+    thread_pool(const thread_pool&) = delete;
+
+    /// <summary>
+    /// Finalises the instance.
+    /// </summary>
+    /// <remarks>
+    /// The destructor executes all tasks that have been submitted before it
+    /// returns.
+    /// </remarks>
+    inline ~thread_pool(void);
+
+    /// <summary>
+    /// Answer the number of threads in the pool.
+    /// </summary>
+    /// <returns>The number of threads, which is at least one.</returns>
+    inline size_type size(void) const noexcept {
+        return this->threads.size();
+    }
+
+    /// <summary>
+    /// Queues <paramref name="task" /> for execution on one of the threads.
+    /// </summary>
+    /// <param name="task">The task to be executed.</param>
+    inline void submit(task_type&& task);
+
+    thread_pool& operator =(const thread_pool&) = delete;
+
+private:
+
+    /// <summary>
+    /// The work loop of a thread in the pool.
+    /// </summary>
+    inline void run(void);
+
+    /// <summary>
+    /// Signals changes of <see cref="queue" /> and <see cref="stop" />.
+    /// </summary>
+    std::condition_variable condition;
+
+    /// <summary>
+    /// Protects the state of the pool.
+    /// </summary>
+    std::mutex lock;
+
+    /// <summary>
+    /// The tasks waiting for a thread.
+    /// </summary>
+    std::deque<task_type> queue;
+
+    /// <summary>
+    /// Instructs the threads to exit once the queue is empty.
+    /// </summary>
+    bool stop;
+
+    /// <summary>
+    /// The threads of the pool.
+    /// </summary>
+    std::vector<std::thread> threads;
+};
+
+DATRAW_DETAIL_NAMESPACE_END
+
+#include "datraw/thread_pool.inl"
+
+#endif /* !defined(_DATRAW_THREAD_POOL_H) */
@@ -0,0 +1,94 @@
+﻿// <copyright file="thread_pool.inl" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2026 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+
+/*
+ * DATRAW_DETAIL_NAMESPACE::thread_pool::thread_pool
+ */
+DATRAW_DETAIL_NAMESPACE::thread_pool::thread_pool(const size_type threads)
+        : stop(false) {
+    auto cnt = threads;
+    if (cnt == 0) {
+        cnt = (std::max)(std::thread::hardware_concurrency(), 1u);
+    }
+
+    try {
+        for (size_type i = 0; i < cnt; ++i) {
+            this->threads.emplace_back(&thread_pool::run, this);
+        }
+    } catch (...) {
+        // The threads we already have must be joined before the vector is
+        // destroyed.
+        {
+            std::lock_guard<std::mutex> l(this->lock);
+            this->stop = true;
+        }
+        this->condition.notify_all();
+        for (auto& t : this->threads) {
+            t.join();
+        }
+        throw;
+    }
+}
+
+
+/*
+ * DATRAW_DETAIL_NAMESPACE::thread_pool::~thread_pool
+ */
+DATRAW_DETAIL_NAMESPACE::thread_pool::~thread_pool(void) {
+    {
+        std::lock_guard<std::mutex> l(this->lock);
+        this->stop = true;
+    }
+
+    this->condition.notify_all();
+    for (auto& t : this->threads) {
+        t.join();
+    }
+}
+
+
+/*
+ * DATRAW_DETAIL_NAMESPACE::thread_pool::submit
+ */
+void DATRAW_DETAIL_NAMESPACE::thread_pool::submit(task_type&& task) {
+    {
+        std::lock_guard<std::mutex> l(this->lock);
+        this->queue.push_back(std::move(task));
+    }
+    this->condition.notify_one();
+}
+
+
+/*
+ * DATRAW_DETAIL_NAMESPACE::thread_pool::run
+ */
+void DATRAW_DETAIL_NAMESPACE::thread_pool::run(void) {
+    for (;;) {
+        task_type task;
+
+        {
+            std::unique_lock<std::mutex> l(this->lock);
+            this->condition.wait(l, [this](void) {
+                return (this->stop || !this->queue.empty());
+            });
+
+            if (this->queue.empty()) {
+                // We were asked to exit and there is nothing left to do.
+                return;
+            }
+
+            task = std::move(this->queue.front());
+            this->queue.pop_front();
+        }
+
+        try {
+            task();
+        } catch (...) {
+            // There is no one we could report the error to.
+        }
+    }
+}
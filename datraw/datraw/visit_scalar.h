@@ -0,0 +1,169 @@
+﻿// <copyright file="visit_scalar.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2026 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_DATRAW_VISIT_SCALAR_H)
+#define _DATRAW_VISIT_SCALAR_H
+#pragma once
+
+#include <cstddef>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "datraw/scalar_type.h"
+
+
+DATRAW_NAMESPACE_BEGIN
+
+/// <summary>
+/// A tag that conveys a <see cref="scalar_type" /> and its C++ type to the
+/// functor of <see cref="visit_scalar" />.
+/// </summary>
+/// <typeparam name="T">The scalar type represented by the tag.</typeparam>
+template<scalar_type T> struct scalar_tag final {
+
+    /// <summary>
+    /// The C++ type of the scalar.
+    /// </summary>
+    typedef scalar_t<T> type;
+
+    /// <summary>
+    /// The scalar type represented by the tag.
+    /// </summary>
+    static constexpr scalar_type value = T;
+};
+
+DATRAW_NAMESPACE_END
+
+
+DATRAW_DETAIL_NAMESPACE_BEGIN
+
+/// <summary>
+/// The numbers of components per element that <see cref="visit_scalar" />
+/// can pass as compile-time constant.
+/// </summary>
+/// <remarks>
+/// These cover scalar fields, 2D and 3D vector fields and RGBA data.
+/// </remarks>
+typedef std::index_sequence<1, 2, 3, 4
+    /* Add new members here. */>
+    component_count_list;
+
+/// <summary>
+/// The type returned by <see cref="visit_scalar" /> for a functor of type
+/// <typeparamref name="F" />.
+/// </summary>
+template<class F> using visit_scalar_t = decltype(std::declval<F&>()(
+    scalar_tag<scalar_type::int8>()));
+
+/// <summary>
+/// The type returned by <see cref="visit_scalar" /> for a functor of type
+/// <typeparamref name="F" /> that also receives the number of components.
+/// </summary>
+template<class F> using visit_components_t = decltype(std::declval<F&>()(
+    scalar_tag<scalar_type::int8>(), std::integral_constant<std::size_t, 1>()));
+
+/// <summary>
+/// Invokes <paramref name="func" /> with the <see cref="scalar_tag" /> of
+/// <paramref name="type" /> if it is <typeparamref name="T" /> or continues
+/// with the rest of the types.
+/// </summary>
+template<class F, scalar_type T, scalar_type... Ts>
+visit_scalar_t<F> visit_scalar(scalar_type_list_t<T, Ts...>,
+    const scalar_type type, F& func);
+
+/// <summary>
+/// Recursion stop for <see cref="visit_scalar" />, which is reached if
+/// <paramref name="type" /> is not supported.
+/// </summary>
+/// <exception cref="std::invalid_argument">In any case.</exception>
+template<class F>
+visit_scalar_t<F> visit_scalar(scalar_type_list_t<>, const scalar_type type,
+    F& func);
+
+/// <summary>
+/// Invokes <paramref name="func" /> with <paramref name="tag" /> and the
+/// number of components as compile-time constant if it is
+/// <typeparamref name="C" /> or continues with the rest of the numbers.
+/// </summary>
+template<class F, class T, std::size_t C, std::size_t... Cs>
+visit_components_t<F> visit_components(std::index_sequence<C, Cs...>,
+    const std::size_t components, F& func, const T tag);
+
+/// <summary>
+/// Recursion stop for <see cref="visit_components" />, which is reached if
+/// the number of components is not supported.
+/// </summary>
+/// <exception cref="std::invalid_argument">In any case.</exception>
+template<class F, class T>
+visit_components_t<F> visit_components(std::index_sequence<>,
+    const std::size_t components, F& func, const T tag);
+
+DATRAW_DETAIL_NAMESPACE_END
+
+
+DATRAW_NAMESPACE_BEGIN
+
+/// <summary>
+/// Invokes <paramref name="func" /> with the <see cref="scalar_tag" /> for
+/// the run-time type <paramref name="type" />.
+/// </summary>
+/// <remarks>
+/// <para>This allows for writing a kernel once as template or generic lambda
+/// and instantiating it for all supported <see cref="scalar_type" />s,
+/// which are generated from the same list as the traits. The type is
+/// resolved once per call rather than per element:</para>
+/// <code>
+/// auto max = datraw::visit_scalar(info.format(), [&amp;](auto tag) {
+///     typedef typename decltype(tag)::type type;
+///     auto s = reinterpret_cast&lt;const type *&gt;(frame.data());
+///     return static_cast&lt;double&gt;(*std::max_element(s, s + cnt));
+/// });
+/// </code>
+/// </remarks>
+/// <typeparam name="F">The type of the functor, which must be callable with
+/// the <see cref="scalar_tag" /> of every supported scalar type and return
+/// the same type for all of them.</typeparam>
+/// <param name="type">The scalar type to dispatch.</param>
+/// <param name="func">The functor to be invoked.</param>
+/// <returns>The value returned by <paramref name="func" />.</returns>
+/// <exception cref="std::invalid_argument">If <paramref name="type" /> is
+/// <see cref="scalar_type::raw" /> or otherwise not supported.</exception>
+template<class F>
+detail::visit_scalar_t<F> visit_scalar(const scalar_type type, F&& func);
+
+/// <summary>
+/// Invokes <paramref name="func" /> with the <see cref="scalar_tag" /> for
+/// the run-time type <paramref name="type" /> and the number of components
+/// per element as <c>std::integral_constant</c>.
+/// </summary>
+/// <remarks>
+/// This variant allows for kernels that process elements of multiple
+/// components, eg vectors or colours, with the loop over the components
+/// being unrolled by the compiler. One to four components are supported.
+/// </remarks>
+/// <typeparam name="F">The type of the functor, which must be callable with
+/// the <see cref="scalar_tag" /> of every supported scalar type and the
+/// constant for every supported number of components and return the same
+/// type for all of them.</typeparam>
+/// <param name="type">The scalar type to dispatch.</param>
+/// <param name="components">The number of components per element, eg
+/// <see cref="basic_info::components" />.</param>
+/// <param name="func">The functor to be invoked.</param>
+/// <returns>The value returned by <paramref name="func" />.</returns>
+/// <exception cref="std::invalid_argument">If <paramref name="type" /> is
+/// <see cref="scalar_type::raw" /> or otherwise not supported, or if the
+/// number of components is not supported.</exception>
+template<class F>
+detail::visit_components_t<F> visit_scalar(const scalar_type type,
+    const std::size_t components, F&& func);
+
+DATRAW_NAMESPACE_END
+
+#include "datraw/visit_scalar.inl"
+
+#endif /* !defined(_DATRAW_VISIT_SCALAR_H) */
@@ -0,0 +1,96 @@
+﻿// <copyright file="visit_scalar.inl" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2026 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+
+/*
+ * DATRAW_NAMESPACE::scalar_tag<T>::value
+ */
+template<DATRAW_NAMESPACE::scalar_type T>
+constexpr DATRAW_NAMESPACE::scalar_type DATRAW_NAMESPACE::scalar_tag<T>::value;
+
+
+/*
+ * DATRAW_NAMESPACE::visit_scalar
+ */
+template<class F>
+DATRAW_DETAIL_NAMESPACE::visit_scalar_t<F> DATRAW_NAMESPACE::visit_scalar(
+        const scalar_type type, F&& func) {
+    return detail::visit_scalar(detail::scalar_type_list(), type, func);
+}
+
+
+/*
+ * DATRAW_NAMESPACE::visit_scalar
+ */
+template<class F>
+DATRAW_DETAIL_NAMESPACE::visit_components_t<F>
+DATRAW_NAMESPACE::visit_scalar(const scalar_type type,
+        const std::size_t components, F&& func) {
+    return DATRAW_NAMESPACE::visit_scalar(type, [&](const auto tag) {
+        return detail::visit_components(detail::component_count_list(),
+            components, func, tag);
+    });
+}
+
+
+/*
+ * DATRAW_DETAIL_NAMESPACE::visit_scalar
+ */
+template<class F, DATRAW_NAMESPACE::scalar_type T,
+    DATRAW_NAMESPACE::scalar_type... Ts>
+DATRAW_DETAIL_NAMESPACE::visit_scalar_t<F>
+DATRAW_DETAIL_NAMESPACE::visit_scalar(scalar_type_list_t<T, Ts...>,
+        const scalar_type type, F& func) {
+    if (type == T) {
+        return func(scalar_tag<T>());
+    } else {
+        return detail::visit_scalar(scalar_type_list_t<Ts...>(), type, func);
+    }
+}
+
+
+/*
+ * DATRAW_DETAIL_NAMESPACE::visit_scalar
+ */
+template<class F>
+DATRAW_DETAIL_NAMESPACE::visit_scalar_t<F>
+DATRAW_DETAIL_NAMESPACE::visit_scalar(scalar_type_list_t<>,
+        const scalar_type type, F&) {
+    std::stringstream msg;
+    msg << "The scalar type " << static_cast<int>(type)
+        << " is not supported." << std::ends;
+    throw std::invalid_argument(msg.str());
+}
+
+
+/*
+ * DATRAW_DETAIL_NAMESPACE::visit_components
+ */
+template<class F, class T, std::size_t C, std::size_t... Cs>
+DATRAW_DETAIL_NAMESPACE::visit_components_t<F>
+DATRAW_DETAIL_NAMESPACE::visit_components(std::index_sequence<C, Cs...>,
+        const std::size_t components, F& func, const T tag) {
+    if (components == C) {
+        return func(tag, std::integral_constant<std::size_t, C>());
+    } else {
+        return detail::visit_components(std::index_sequence<Cs...>(),
+            components, func, tag);
+    }
+}
+
+
+/*
+ * DATRAW_DETAIL_NAMESPACE::visit_components
+ */
+template<class F, class T>
+DATRAW_DETAIL_NAMESPACE::visit_components_t<F>
+DATRAW_DETAIL_NAMESPACE::visit_components(std::index_sequence<>,
+        const std::size_t components, F&, const T) {
+    std::stringstream msg;
+    msg << "Elements with " << components << " component(s) are not "
+        "supported." << std::ends;
+    throw std::invalid_argument(msg.str());
+}
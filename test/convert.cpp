@@ -1,5 +1,5 @@
 ﻿// <copyright file="convert.cpp" company="Visualisierungsinstitut der Universität Stuttgart">
-// Copyright © 2017 - 2024 Visualisierungsinstitut der Universität Stuttgart.
+// Copyright © 2017 - 2026 Visualisierungsinstitut der Universität Stuttgart.
 // Licensed under the MIT licence. See LICENCE file for details.
 // </copyright>
 // <author>Christoph Müller</author>
@@ -17,6 +17,127 @@ namespace test {
 
     public:
 
+        TEST_METHOD(TestCopySwapByteOrder) {
+            this->testCopySwapByteOrder<std::uint16_t>();
+            this->testCopySwapByteOrder<std::uint32_t>();
+            this->testCopySwapByteOrder<std::uint64_t>();
+
+            {
+                std::vector<std::uint8_t> src(100), dst(src.size());
+                std::iota(src.begin(), src.end(), std::uint8_t(0));
+                datraw::copy_swap_byte_order(1, src.data(), dst.data(), src.size());
+                Assert::IsTrue(src == dst, L"Single bytes are copied.", LINE_INFO());
+            }
+        }
+
+        TEST_METHOD(TestConvertAutoRange) {
+            std::vector<float> in(1000 + 3);
+            for (std::size_t i = 0; i < in.size(); ++i) {
+                in[i] = 10.0f * static_cast<float>(i) / static_cast<float>(in.size() - 1) - 5.0f;
+            }
+
+            std::vector<std::uint8_t> out(in.size());
+            const auto range = datraw::convert_auto_range<std::uint8_t>(in.data(), in.data() + in.size(), out.data());
+            Assert::AreEqual(-5.0f, range.first, L"Minimum found.", LINE_INFO());
+            Assert::AreEqual(5.0f, range.second, L"Maximum found.", LINE_INFO());
+            Assert::AreEqual(std::uint8_t(0), out.front(), L"Minimum mapped to zero.", LINE_INFO());
+            Assert::AreEqual(std::uint8_t(255), out.back(), L"Maximum mapped to one.", LINE_INFO());
+
+            std::vector<std::uint8_t> expected(in.size());
+            datraw::convert_window<std::uint8_t>(in.begin(), in.end(), expected.begin(), -5.0, 5.0);
+            Assert::IsTrue(expected == out, L"Same as explicit window.", LINE_INFO());
+
+            {
+                std::vector<std::uint16_t> constant(100, 42);
+                std::vector<float> zero(constant.size());
+                datraw::convert_auto_range<float>(constant.begin(), constant.end(), zero.begin());
+                Assert::IsTrue(std::all_of(zero.begin(), zero.end(), [](const float f) { return f == 0.0f; }), L"Constant data are mapped to zero.", LINE_INFO());
+            }
+        }
+
+        TEST_METHOD(TestConvertWindow) {
+            {
+                std::array<std::uint16_t, 5> in = { 500, 1000, 2000, 3000, 4000 };
+                std::array<float, 5> out;
+                datraw::convert_window<float>(in.begin(), in.end(), out.begin(), 1000.0, 3000.0);
+                Assert::AreEqual(0.0f, out[0], L"Below window clamped.", LINE_INFO());
+                Assert::AreEqual(0.0f, out[1], L"Lower bound of window.", LINE_INFO());
+                Assert::AreEqual(0.5f, out[2], L"Centre of window.", LINE_INFO());
+                Assert::AreEqual(1.0f, out[3], L"Upper bound of window.", LINE_INFO());
+                Assert::AreEqual(1.0f, out[4], L"Above window clamped.", LINE_INFO());
+            }
+
+            {
+                std::array<std::uint16_t, 4> in = { 0, 1, 2, 3 };
+                std::array<std::uint64_t, 4> out;
+                datraw::convert_window<std::uint64_t>(in.begin(), in.end(), out.begin(), 0.0, 3.0);
+                Assert::AreEqual(std::uint64_t(0), out[0], L"Lower bound of window.", LINE_INFO());
+                Assert::IsTrue(out[2] < out[3], L"Upper bound of window is the largest value.", LINE_INFO());
+                Assert::IsTrue(out[3] >= (std::numeric_limits<std::uint64_t>::max)() - 2048, L"Upper bound of window is close to maximum.", LINE_INFO());
+            }
+
+            {
+                std::array<std::uint16_t, 4> in = { 0, 1, 2, 3 };
+                std::array<std::int64_t, 4> out;
+                datraw::convert_window<std::int64_t>(in.begin(), in.end(), out.begin(), 0.0, 3.0);
+                Assert::AreEqual((std::numeric_limits<std::int64_t>::min)(), out[0], L"Lower bound of window.", LINE_INFO());
+                Assert::IsTrue(out[2] < out[3], L"Upper bound of window is the largest value.", LINE_INFO());
+                Assert::IsTrue(out[3] >= (std::numeric_limits<std::int64_t>::max)() - 1024, L"Upper bound of window is close to maximum.", LINE_INFO());
+            }
+
+            Assert::ExpectException<std::invalid_argument>([&]() {
+                std::array<float, 1> in = { 0.0f }, out;
+                datraw::convert_window<float>(in.begin(), in.end(), out.begin(), 1.0, 0.0);
+            }, L"Empty window is rejected.", LINE_INFO());
+
+            std::vector<std::uint8_t> u8(1000 + 7);
+            for (std::size_t i = 0; i < u8.size(); ++i) {
+                u8[i] = static_cast<std::uint8_t>(i);
+            }
+            this->testWindow<float>(u8, 20.0, 200.0);
+            this->testWindow<std::uint8_t>(u8, 20.0, 200.0);
+            this->testWindow<std::uint16_t>(u8, 20.0, 200.0);
+
+            std::vector<std::uint16_t> u16(65536 + 7);
+            std::iota(u16.begin(), u16.end(), std::uint16_t(0));
+            this->testWindow<float>(u16, 1000.0, 3000.0);
+            this->testWindow<std::uint8_t>(u16, 1000.0, 3000.0);
+            this->testWindow<std::uint16_t>(u16, 1000.0, 3000.0);
+            this->testWindow<datraw::float16>(u16, 1000.0, 3000.0);
+
+            std::vector<std::int16_t> i16(65536 + 7);
+            std::iota(i16.begin(), i16.end(), (std::numeric_limits<std::int16_t>::min)());
+            this->testWindow<float>(i16, -1024.0, 3071.0);
+            this->testWindow<std::uint8_t>(i16, -1024.0, 3071.0);
+            this->testWindow<std::uint16_t>(i16, -1024.0, 3071.0);
+            this->testWindow<std::int32_t>(i16, -1024.0, 3071.0);
+
+            std::vector<float> f32(100000 + 13);
+            for (std::size_t i = 0; i < f32.size(); ++i) {
+                f32[i] = static_cast<float>(i) / static_cast<float>(f32.size() - 1);
+            }
+            this->testWindow<float>(f32, 0.25, 0.75);
+            this->testWindow<std::uint8_t>(f32, 0.25, 0.75);
+            this->testWindow<std::uint16_t>(f32, 0.25, 0.75);
+            this->testWindow<double>(f32, 0.25, 0.75);
+        }
+
+        TEST_METHOD(TestFindRange) {
+            {
+                std::vector<float> empty;
+                const auto range = datraw::find_range(empty.begin(), empty.end());
+                Assert::AreEqual(0.0f, range.first, L"Empty range yields zero.", LINE_INFO());
+                Assert::AreEqual(0.0f, range.second, L"Empty range yields zero.", LINE_INFO());
+            }
+
+            this->testFindRange<std::uint8_t>();
+            this->testFindRange<std::uint16_t>();
+            this->testFindRange<std::int16_t>();
+            this->testFindRange<std::int32_t>();
+            this->testFindRange<float>();
+            this->testFindRange<double>();
+        }
+
         TEST_METHOD(TestFloatToDouble) {
             std::array<float, 256> in;
             std::array<double, 256> out;
@@ -45,6 +166,118 @@ namespace test {
             }
         }
 
+        TEST_METHOD(TestHalf) {
+            typedef std::numeric_limits<datraw::float16> limits;
+            Assert::AreEqual(-65504.0f, static_cast<float>(limits::lowest()), L"Lowest half.", LINE_INFO());
+            Assert::AreEqual(65504.0f, static_cast<float>((limits::max)()), L"Largest half.", LINE_INFO());
+
+            {
+                std::vector<std::uint8_t> in(256);
+                std::iota(in.begin(), in.end(), std::uint8_t(0));
+                std::vector<datraw::float16> out(in.size());
+                datraw::convert(in.begin(), in.end(), out.begin());
+
+                for (std::size_t i = 0; i < out.size(); ++i) {
+                    Assert::IsTrue(datraw::float16(float(i) / 255.0f) == out[i], L"Integer to half via float.", LINE_INFO());
+                }
+
+                std::vector<std::uint8_t> back(in.size());
+                datraw::convert(out.begin(), out.end(), back.begin());
+
+                for (std::size_t i = 0; i < back.size(); ++i) {
+                    Assert::AreEqual(std::uint8_t(static_cast<float>(out[i]) * 255.0f), back[i], L"Half to integer via float.", LINE_INFO());
+                }
+
+                std::vector<double> wide(in.size());
+                datraw::convert(out.begin(), out.end(), wide.begin());
+
+                for (std::size_t i = 0; i < wide.size(); ++i) {
+                    Assert::AreEqual(double(static_cast<float>(out[i])), wide[i], L"Half to double by cast.", LINE_INFO());
+                }
+            }
+
+            std::vector<datraw::float16> f16(100000 + 13);
+            for (std::size_t i = 0; i < f16.size(); ++i) {
+                f16[i] = datraw::float16(static_cast<float>(i) / static_cast<float>(f16.size() - 1));
+            }
+            this->testVectorised<float>(f16);
+            this->testVectorised<std::uint8_t>(f16);
+            this->testVectorised<std::uint16_t>(f16);
+
+            std::vector<float> f32(f16.size());
+            datraw::convert(f16.data(), f16.data() + f16.size(), f32.data());
+            this->testVectorised<datraw::float16>(f32);
+
+            std::vector<std::uint8_t> u8(1000 + 7);
+            for (std::size_t i = 0; i < u8.size(); ++i) {
+                u8[i] = static_cast<std::uint8_t>(i);
+            }
+            this->testVectorised<datraw::float16>(u8);
+
+            std::vector<std::uint16_t> u16(65536 + 7);
+            std::iota(u16.begin(), u16.end(), std::uint16_t(0));
+            this->testVectorised<datraw::float16>(u16);
+
+            std::vector<std::int16_t> i16(65536 + 7);
+            std::iota(i16.begin(), i16.end(), (std::numeric_limits<std::int16_t>::min)());
+            this->testVectorised<datraw::float16>(i16);
+        }
+
+        TEST_METHOD(TestLookupTable) {
+            {
+                std::vector<std::int16_t> in(70000);
+                for (std::size_t i = 0; i < in.size(); ++i) {
+                    in[i] = static_cast<std::int16_t>(i * 7);
+                }
+
+                // The large range is converted via the table, the single
+                // elements via the scalar code.
+                std::vector<double> actual(in.size());
+                datraw::convert<double>(in.begin(), in.end(), actual.begin());
+
+                for (std::size_t i = 0; i < in.size(); ++i) {
+                    double expected;
+                    datraw::convert<double>(in.begin() + i, in.begin() + i + 1, &expected);
+                    Assert::AreEqual(expected, actual[i], L"Table conversion matches scalar one.", LINE_INFO());
+                }
+            }
+
+            {
+                const auto& table = datraw::lookup_table<std::int8_t, std::uint16_t>::standard();
+                Assert::AreEqual(std::size_t(256), table.entries(), L"Table has an entry for each value.", LINE_INFO());
+                Assert::IsTrue(&table == &datraw::lookup_table<std::int8_t, std::uint16_t>::standard(), L"Standard table is cached.", LINE_INFO());
+
+                for (int i = -128; i < 128; ++i) {
+                    const auto value = static_cast<std::int8_t>(i);
+                    std::uint16_t expected;
+                    datraw::convert<std::uint16_t>(&value, &value + 1, &expected);
+                    Assert::AreEqual(expected, table[value], L"Standard table matches conversion rules.", LINE_INFO());
+                }
+            }
+
+            {
+                datraw::lookup_table<std::uint8_t, datraw::float16> table;
+                for (int i = 0; i < 256; ++i) {
+                    const auto value = static_cast<std::uint8_t>(i);
+                    Assert::IsTrue(datraw::float16(value / 255.0f) == table[value], L"Half-precision table is filled via float.", LINE_INFO());
+                }
+            }
+
+            {
+                auto table = datraw::lookup_table<std::uint8_t, std::uint8_t>::make([](const std::uint8_t v) {
+                    return static_cast<std::uint8_t>(255 - v);
+                });
+
+                std::vector<std::uint8_t> in(256), out(in.size());
+                std::iota(in.begin(), in.end(), std::uint8_t(0));
+                table.apply(in.begin(), in.end(), out.begin());
+
+                for (std::size_t i = 0; i < in.size(); ++i) {
+                    Assert::AreEqual(static_cast<std::uint8_t>(255 - in[i]), out[i], L"Custom table is applied.", LINE_INFO());
+                }
+            }
+        }
+
         TEST_METHOD(TestMove) {
             std::array<unsigned char, 256> in;
             std::array<unsigned char, 256> out;
@@ -61,6 +294,151 @@ namespace test {
             }
         }
 
+        TEST_METHOD(TestParallelConvert) {
+            std::vector<unsigned short> in(300000);
+            std::iota(in.begin(), in.end(), 0);
+
+            std::vector<float> expected(in.size());
+            datraw::convert(in.cbegin(), in.cend(), expected.begin());
+
+            for (std::size_t concurrency = 0; concurrency < 4; ++concurrency) {
+                std::vector<float> actual(in.size());
+                datraw::convert(in.cbegin(), in.cend(), actual.begin(), concurrency);
+                Assert::IsTrue(expected == actual, L"Parallel conversion matches serial one.", LINE_INFO());
+            }
+        }
+
+        TEST_METHOD(TestParallelFor) {
+            {
+                std::vector<int> hits(1000, 0);
+                datraw::detail::parallel_for(hits.size(), 0, [&hits](const std::size_t i) { ++hits[i]; });
+                Assert::IsTrue(std::all_of(hits.begin(), hits.end(), [](const int h) { return (h == 1); }), L"Each work item is processed once.", LINE_INFO());
+            }
+
+            Assert::ExpectException<std::runtime_error>([&]() {
+                datraw::detail::parallel_for(1000, 0, [](const std::size_t i) {
+                    if (i == 500) {
+                        throw std::runtime_error("test");
+                    }
+                });
+            }, L"Exception is rethrown on calling thread.", LINE_INFO());
+
+            {
+                // Nested calls from all threads of the pool must not deadlock.
+                auto& pool = datraw::detail::thread_pool::instance();
+                std::vector<std::vector<int>> hits(pool.size() + 1, std::vector<int>(1000, 0));
+                std::vector<std::promise<void>> promises(hits.size());
+                std::vector<std::future<void>> futures;
+                for (auto& p : promises) {
+                    futures.push_back(p.get_future());
+                }
+
+                for (std::size_t t = 0; t < hits.size(); ++t) {
+                    auto h = &hits[t];
+                    auto p = &promises[t];
+                    pool.submit([h, p](void) {
+                        datraw::detail::parallel_for(h->size(), 0, [h](const std::size_t i) { ++(*h)[i]; });
+                        p->set_value();
+                    });
+                }
+
+                for (auto& f : futures) {
+                    f.wait();
+                }
+
+                for (auto& h : hits) {
+                    Assert::IsTrue(std::all_of(h.begin(), h.end(), [](const int v) { return (v == 1); }), L"Each nested work item is processed once.", LINE_INFO());
+                }
+            }
+        }
+
+        TEST_METHOD(TestParallelSwapByteOrder) {
+            std::vector<std::uint64_t> expected(300000);
+            std::iota(expected.begin(), expected.end(), std::uint64_t(1));
+
+            auto actual = expected;
+            datraw::swap_byte_order(expected.data(), expected.size());
+            datraw::swap_byte_order(sizeof(std::uint64_t), actual.data(), actual.size(), 3);
+            Assert::IsTrue(expected == actual, L"Parallel swap matches serial one.", LINE_INFO());
+
+            std::vector<std::uint64_t> copy(actual.size());
+            datraw::copy_swap_byte_order(sizeof(std::uint64_t), actual.data(), copy.data(), actual.size(), 0);
+            datraw::swap_byte_order(actual.data(), actual.size());
+            Assert::IsTrue(actual == copy, L"Parallel copy and swap matches serial one.", LINE_INFO());
+        }
+
+        TEST_METHOD(TestRuntimeTypes) {
+            std::vector<std::uint16_t> u16(1000);
+            std::iota(u16.begin(), u16.end(), std::uint16_t(0));
+
+            {
+                std::vector<float> expected(u16.size());
+                datraw::convert(u16.begin(), u16.end(), expected.begin());
+                std::vector<float> actual(u16.size());
+                datraw::convert(datraw::scalar_type::uint16, u16.data(), datraw::scalar_type::float32, actual.data(), u16.size());
+                Assert::IsTrue(expected == actual, L"uint16 to float32.", LINE_INFO());
+            }
+
+            {
+                std::vector<datraw::float16> expected(u16.size());
+                datraw::convert(u16.begin(), u16.end(), expected.begin());
+                std::vector<datraw::float16> actual(u16.size());
+                datraw::convert(datraw::scalar_type::uint16, u16.data(), datraw::scalar_type::float16, actual.data(), u16.size());
+                Assert::IsTrue(expected == actual, L"uint16 to float16.", LINE_INFO());
+            }
+
+            {
+                std::vector<std::int64_t> expected(u16.size());
+                datraw::convert(u16.begin(), u16.end(), expected.begin());
+                std::vector<std::int64_t> actual(u16.size());
+                datraw::convert(datraw::scalar_type::uint16, u16.data(), datraw::scalar_type::int64, actual.data(), u16.size());
+                Assert::IsTrue(expected == actual, L"uint16 to int64.", LINE_INFO());
+            }
+
+            {
+                std::vector<std::uint16_t> actual(u16.size());
+                datraw::convert(datraw::scalar_type::uint16, u16.data(), datraw::scalar_type::uint16, actual.data(), u16.size());
+                Assert::IsTrue(u16 == actual, L"Identity is a copy.", LINE_INFO());
+            }
+
+            Assert::ExpectException<std::invalid_argument>([&]() {
+                std::vector<std::uint8_t> dst(u16.size());
+                datraw::convert(datraw::scalar_type::raw, u16.data(), datraw::scalar_type::uint8, dst.data(), u16.size());
+            }, L"Raw data cannot be converted.", LINE_INFO());
+            Assert::ExpectException<std::invalid_argument>([&]() {
+                std::vector<std::uint8_t> dst(u16.size() * 2);
+                datraw::convert(datraw::scalar_type::uint16, u16.data(), datraw::scalar_type::raw, dst.data(), u16.size());
+            }, L"Data cannot be converted to raw.", LINE_INFO());
+        }
+
+        TEST_METHOD(TestSwapByteOrder) {
+            this->testSwapByteOrder<std::uint16_t>();
+            this->testSwapByteOrder<std::uint32_t>();
+            this->testSwapByteOrder<std::uint64_t>();
+        }
+
+        TEST_METHOD(TestVectorised) {
+            std::vector<std::uint8_t> u8(256 + 7);
+            std::iota(u8.begin(), u8.end(), std::uint8_t(0));
+            this->testVectorised<float>(u8);
+
+            std::vector<std::uint16_t> u16(65536 + 7);
+            std::iota(u16.begin(), u16.end(), std::uint16_t(0));
+            this->testVectorised<float>(u16);
+            this->testVectorised<std::uint8_t>(u16);
+
+            std::vector<std::int16_t> i16(65536 + 7);
+            std::iota(i16.begin(), i16.end(), (std::numeric_limits<std::int16_t>::min)());
+            this->testVectorised<float>(i16);
+
+            std::vector<float> f32(100000 + 13);
+            for (std::size_t i = 0; i < f32.size(); ++i) {
+                f32[i] = static_cast<float>(i) / static_cast<float>(f32.size() - 1);
+            }
+            this->testVectorised<std::uint8_t>(f32);
+            this->testVectorised<std::uint16_t>(f32);
+        }
+
         TEST_METHOD(TestUcharToFloat) {
             std::array<unsigned char, 256> in;
             std::array<float, 256> out;
@@ -130,6 +508,122 @@ namespace test {
             }
         }
 
+    private:
+
+        template<class T, class S> void testVectorised(const std::vector<S>& in) {
+            // Iterators of std::deque are not processed by the vectorised
+            // kernels, so they serve as reference.
+            const std::deque<S> reference(in.begin(), in.end());
+            std::deque<T> expected(in.size());
+            datraw::convert<T>(reference.begin(), reference.end(), expected.begin());
 
+            std::vector<T> actual(in.size());
+            datraw::convert<T>(in.data(), in.data() + in.size(), actual.data());
+
+            for (std::size_t i = 0; i < in.size(); ++i) {
+                Assert::IsTrue(std::memcmp(&expected[i], &actual[i], sizeof(T)) == 0, L"Vectorised conversion is bit-compatible.", LINE_INFO());
+            }
+
+            std::vector<T> iterated(in.size());
+            datraw::convert<T>(in.cbegin(), in.cend(), iterated.begin());
+
+            for (std::size_t i = 0; i < in.size(); ++i) {
+                Assert::IsTrue(std::memcmp(&expected[i], &iterated[i], sizeof(T)) == 0, L"Vectorised conversion via vector iterators is bit-compatible.", LINE_INFO());
+            }
+        }
+
+        template<class T> void testFindRange(void) {
+            // Place the extremes at all positions in order to cover the
+            // vector kernels and the scalar tail.
+            for (std::size_t cnt : { 1, 7, 31, 100, 1000 }) {
+                for (std::size_t pos = 0; pos < cnt; pos += (std::max)(std::size_t(1), cnt / 13)) {
+                    std::vector<T> in(cnt, T(10));
+                    in[pos] = T(3);
+                    in[cnt - 1 - pos] = T(100);
+                    if (cnt == 1) {
+                        in[0] = T(3);
+                    }
+
+                    auto expected = std::minmax_element(in.begin(), in.end());
+                    auto actual = datraw::find_range(in.data(), in.data() + in.size());
+                    Assert::IsTrue(*expected.first == actual.first, L"Minimum found.", LINE_INFO());
+                    Assert::IsTrue(*expected.second == actual.second, L"Maximum found.", LINE_INFO());
+                }
+            }
+        }
+
+        template<class T, class S> void testWindow(const std::vector<S>& in, const double min, const double max) {
+            // Iterators of std::vector are not processed by the vectorised
+            // kernels, so they serve as reference.
+            std::vector<T> expected(in.size());
+            datraw::convert_window<T>(in.begin(), in.end(), expected.begin(), min, max);
+
+            std::vector<T> actual(in.size());
+            datraw::convert_window<T>(in.data(), in.data() + in.size(), actual.data(), min, max);
+
+            for (std::size_t i = 0; i < in.size(); ++i) {
+                Assert::IsTrue(std::memcmp(&expected[i], &actual[i], sizeof(T)) == 0, L"Vectorised window is bit-compatible.", LINE_INFO());
+            }
+        }
+
+        template<class T> void testCopySwapByteOrder(void) {
+            std::vector<T> src(300);
+            std::iota(src.begin(), src.end(), T(1));
+            const auto original = src;
+
+            for (std::size_t offset = 0; offset < 3; ++offset) {
+                for (std::size_t cnt = 0; cnt + offset <= src.size(); cnt += 7) {
+                    std::vector<T> dst(src.size(), T(0));
+                    datraw::copy_swap_byte_order(sizeof(T), src.data() + offset, dst.data() + offset, cnt);
+
+                    Assert::IsTrue(original == src, L"Source is not modified.", LINE_INFO());
+
+                    for (std::size_t i = 0; i < dst.size(); ++i) {
+                        auto expected = T(0);
+                        if ((i >= offset) && (i < offset + cnt)) {
+                            expected = src[i];
+                            auto bytes = reinterpret_cast<std::uint8_t *>(&expected);
+                            std::reverse(bytes, bytes + sizeof(T));
+                        }
+                        Assert::IsTrue(expected == dst[i], L"Designated elements copied and swapped.", LINE_INFO());
+                    }
+                }
+            }
+        }
+
+        template<class T> void testSwapByteOrder(void) {
+            // Cover the vector kernels as well as the scalar tail, also for
+            // data that are not aligned to the width of a vector register.
+            std::vector<T> data(300);
+
+            for (std::size_t offset = 0; offset < 3; ++offset) {
+                for (std::size_t cnt = 0; cnt + offset <= data.size(); cnt += 7) {
+                    for (std::size_t i = 0; i < data.size(); ++i) {
+                        data[i] = static_cast<T>(0x0102030405060708ULL * (i + 1));
+                    }
+
+                    datraw::swap_byte_order(data.data() + offset, cnt);
+
+                    for (std::size_t i = 0; i < data.size(); ++i) {
+                        auto expected = static_cast<T>(0x0102030405060708ULL * (i + 1));
+                        if ((i >= offset) && (i < offset + cnt)) {
+                            auto bytes = reinterpret_cast<std::uint8_t *>(&expected);
+                            std::reverse(bytes, bytes + sizeof(T));
+                        }
+                        Assert::IsTrue(expected == data[i], L"Byte order of designated elements swapped.", LINE_INFO());
+                    }
+                }
+            }
+
+            {
+                std::vector<T> expected(data.size());
+                std::iota(expected.begin(), expected.end(), T(1));
+                data = expected;
+
+                datraw::swap_byte_order(sizeof(T), data.data(), data.size());
+                datraw::swap_byte_order(sizeof(T), data.data(), data.size());
+                Assert::IsTrue(expected == data, L"Swapping twice is identity.", LINE_INFO());
+            }
+        }
     };
 }
@@ -17,6 +17,44 @@ namespace test {
 
     public:
 
+        TEST_METHOD(BulkConversion) {
+            // Widen every possible bit pattern.
+            std::vector<datraw::half> halves(65536 + 3);
+            for (std::size_t i = 0; i < halves.size(); ++i) {
+                halves[i] = datraw::half::from_bits(static_cast<std::uint16_t>(i));
+            }
+
+            std::vector<float> floats(halves.size());
+            datraw::half_to_float(halves.data(), floats.data(), floats.size());
+
+            for (std::size_t i = 0; i < halves.size(); ++i) {
+                const auto expected = static_cast<float>(halves[i]);
+                if (std::isnan(expected)) {
+                    Assert::IsTrue(std::isnan(floats[i]), L"NaN is widened to NaN.", LINE_INFO());
+                } else {
+                    Assert::AreEqual(expected, floats[i], L"Bulk widening matches single conversion.", LINE_INFO());
+                }
+            }
+
+            // Narrow arbitrary bit patterns including ones that need rounding.
+            std::uint32_t state = 42;
+            for (auto& f : floats) {
+                state = state * 1664525u + 1013904223u;
+                std::memcpy(&f, &state, sizeof(f));
+            }
+
+            std::vector<datraw::half> narrowed(floats.size());
+            datraw::float_to_half(floats.data(), narrowed.data(), floats.size());
+
+            for (std::size_t i = 0; i < floats.size(); ++i) {
+                if (std::isnan(floats[i])) {
+                    Assert::IsTrue(std::isnan(static_cast<float>(narrowed[i])), L"NaN is narrowed to NaN.", LINE_INFO());
+                } else {
+                    Assert::IsTrue(datraw::half(floats[i]) == narrowed[i], L"Bulk narrowing matches single conversion.", LINE_INFO());
+                }
+            }
+        }
+
         TEST_METHOD(Construction) {
             {
                 datraw::half h;
@@ -103,6 +103,8 @@ Components: 4\n\
                 Assert::AreEqual(std::size_t(288 * 4), i.row_size(), L"Computed correct row size.", LINE_INFO());
                 Assert::AreEqual(i.row_size(), i.row_pitch(), L"Computed correct row pitch.", LINE_INFO());
                 Assert::AreEqual(std::size_t(1280), i.row_pitch(256), L"Computed correct aligned row pitch.", LINE_INFO());
+                Assert::AreEqual(std::size_t(2000), i.row_pitch(1000), L"Aligned row pitch is rounded up to a multiple of the alignment.", LINE_INFO());
+                Assert::AreEqual(std::size_t(1152), i.row_pitch(384), L"Row pitch is unchanged if already aligned.", LINE_INFO());
             }
 
             {
@@ -1,5 +1,5 @@
 ﻿// <copyright file="raw_reader.cpp" company="Visualisierungsinstitut der Universität Stuttgart">
-// Copyright © 2017 - 2024 Visualisierungsinstitut der Universität Stuttgart.
+// Copyright © 2017 - 2026 Visualisierungsinstitut der Universität Stuttgart.
 // Licensed under the MIT licence. See LICENCE file for details.
 // </copyright>
 // <author>Christoph Müller</author>
@@ -40,6 +40,235 @@ namespace test {
             this->testOffsetArgCheck<wchar_t>();
         }
 
+        TEST_METHOD(TestMapChar) {
+            this->testMap<char>();
+        }
+
+        TEST_METHOD(TestMapWchar) {
+            this->testMap<wchar_t>();
+        }
+
+        TEST_METHOD(TestReadRegionChar) {
+            this->testReadRegion<char>();
+        }
+
+        TEST_METHOD(TestReadRegionWchar) {
+            this->testReadRegion<wchar_t>();
+        }
+
+        TEST_METHOD(TestReadSliceChar) {
+            this->testReadSlice<char>();
+        }
+
+        TEST_METHOD(TestReadSliceWchar) {
+            this->testReadSlice<wchar_t>();
+        }
+
+        TEST_METHOD(TestPrefetchChar) {
+            this->testPrefetch<char>();
+        }
+
+        TEST_METHOD(TestPrefetchWchar) {
+            this->testPrefetch<wchar_t>();
+        }
+
+        TEST_METHOD(TestFileCacheChar) {
+            this->testFileCache<char>();
+        }
+
+        TEST_METHOD(TestFileCacheWchar) {
+            this->testFileCache<wchar_t>();
+        }
+
+        TEST_METHOD(TestReadUninitialisedChar) {
+            this->testReadUninitialised<char>();
+        }
+
+        TEST_METHOD(TestReadUninitialisedWchar) {
+            this->testReadUninitialised<wchar_t>();
+        }
+
+        TEST_METHOD(TestForEachChunkChar) {
+            this->testForEachChunk<char>();
+        }
+
+        TEST_METHOD(TestForEachChunkWchar) {
+            this->testForEachChunk<wchar_t>();
+        }
+
+        TEST_METHOD(TestReadRangeChar) {
+            this->testReadRange<char>();
+        }
+
+        TEST_METHOD(TestReadRangeWchar) {
+            this->testReadRange<wchar_t>();
+        }
+
+        TEST_METHOD(TestReadAsyncChar) {
+            this->testReadAsync<char>();
+        }
+
+        TEST_METHOD(TestReadAsyncWchar) {
+            this->testReadAsync<wchar_t>();
+        }
+
+        TEST_METHOD(TestDirectIoChar) {
+            this->testDirectIo<char>();
+        }
+
+        TEST_METHOD(TestDirectIoWchar) {
+            this->testDirectIo<wchar_t>();
+        }
+
+        TEST_METHOD(TestStrictGeometryChar) {
+            this->testStrictGeometry<char>();
+        }
+
+        TEST_METHOD(TestStrictGeometryWchar) {
+            this->testStrictGeometry<wchar_t>();
+        }
+
+        TEST_METHOD(TestReadAsChar) {
+            this->testReadAs<char>();
+        }
+
+        TEST_METHOD(TestReadAsWchar) {
+            this->testReadAs<wchar_t>();
+        }
+
+        TEST_METHOD(TestAccessPolicyChar) {
+            this->testAccessPolicy<char>();
+        }
+
+        TEST_METHOD(TestAccessPolicyWchar) {
+            this->testAccessPolicy<wchar_t>();
+        }
+
+        TEST_METHOD(TestReadTimeRangeChar) {
+            this->testReadTimeRange<char>();
+        }
+
+        TEST_METHOD(TestReadTimeRangeWchar) {
+            this->testReadTimeRange<wchar_t>();
+        }
+
+        TEST_METHOD(TestReadPitchedChar) {
+            this->testReadPitched<char>();
+        }
+
+        TEST_METHOD(TestReadPitchedWchar) {
+            this->testReadPitched<wchar_t>();
+        }
+
+        TEST_METHOD(TestAsyncIoThreadPool) {
+            datraw::detail::async_io io(false, 3);
+            Assert::IsTrue(io.backend() == datraw::detail::async_io::backend_type::thread_pool, L"Thread pool is used if requested.", LINE_INFO());
+
+            std::vector<std::uint8_t> expected(64 * 1024);
+            std::generate(expected.begin(),
+                expected.end(),
+                [](void) {
+                return static_cast<std::uint8_t>(std::rand() % 256);
+            });
+
+            {
+                std::fstream stream("test.raw", std::ios::out
+                    | std::ios::binary);
+                stream.write(reinterpret_cast<const char *>(expected.data()),
+                    expected.size());
+                stream.close();
+            }
+
+            std::shared_ptr<const datraw::detail::file> file = std::make_shared<datraw::detail::file>(datraw::detail::file::open(std::string("test.raw")));
+            std::vector<std::uint8_t> actual(expected.size());
+            std::vector<std::uint8_t> tail(20);
+            std::vector<std::promise<void>> promises(3);
+
+            std::vector<datraw::detail::async_io::request_type> requests(3);
+            for (std::size_t i = 0; i < requests.size(); ++i) {
+                requests[i].source = file;
+                requests[i].completion = [&promises, i](std::exception_ptr e) {
+                    if (e) {
+                        promises[i].set_exception(e);
+                    } else {
+                        promises[i].set_value();
+                    }
+                };
+            }
+            requests[0].reads.push_back({ 0, actual.data(), 1000 });
+            requests[0].reads.push_back({ 1000, actual.data() + 1000, 31000 });
+            requests[1].reads.push_back({ 32000, actual.data() + 32000, actual.size() - 32000 });
+            requests[2].reads.push_back({ actual.size() - 10, tail.data(), tail.size() });
+
+            auto f0 = promises[0].get_future();
+            auto f1 = promises[1].get_future();
+            auto f2 = promises[2].get_future();
+            io.submit(std::move(requests));
+
+            f0.get();
+            f1.get();
+            Assert::IsTrue(expected == actual, L"Batch has been read.", LINE_INFO());
+
+            Assert::ExpectException<std::runtime_error>([&]() {
+                f2.get();
+            }, L"Read beyond end of file is reported.", LINE_INFO());
+        }
+
+        TEST_METHOD(TestAsyncIoProcess) {
+            std::vector<std::uint8_t> expected(64 * 1024);
+            std::generate(expected.begin(),
+                expected.end(),
+                [](void) {
+                return static_cast<std::uint8_t>(std::rand() % 256);
+            });
+
+            {
+                std::fstream stream("test.raw", std::ios::out
+                    | std::ios::binary);
+                stream.write(reinterpret_cast<const char *>(expected.data()),
+                    expected.size());
+                stream.close();
+            }
+
+            for (auto& e : expected) {
+                e = static_cast<std::uint8_t>(~e);
+            }
+
+            std::shared_ptr<const datraw::detail::file> file = std::make_shared<datraw::detail::file>(datraw::detail::file::open(std::string("test.raw")));
+
+            for (auto allowUring : { false, true }) {
+                datraw::detail::async_io io(allowUring);
+                std::vector<std::uint8_t> actual(expected.size());
+                std::atomic<std::size_t> processed(0);
+                std::promise<void> promise;
+                auto future = promise.get_future();
+
+                datraw::detail::async_io::request_type request;
+                request.source = file;
+                request.completion = [&promise](std::exception_ptr e) {
+                    if (e) {
+                        promise.set_exception(e);
+                    } else {
+                        promise.set_value();
+                    }
+                };
+                request.process = [&processed](void *data, const std::size_t size) {
+                    auto d = static_cast<std::uint8_t *>(data);
+                    for (std::size_t i = 0; i < size; ++i) {
+                        d[i] = static_cast<std::uint8_t>(~d[i]);
+                    }
+                    processed += size;
+                };
+                request.reads.push_back({ 0, actual.data(), 1000 });
+                request.reads.push_back({ 1000, actual.data() + 1000, actual.size() - 1000 });
+                io.submit(std::move(request));
+
+                future.get();
+                Assert::AreEqual(actual.size(), processed.load(), L"All data have been processed.", LINE_INFO());
+                Assert::IsTrue(expected == actual, L"Data have been processed before completion.", LINE_INFO());
+            }
+        }
+
     private:
 
         template<class C> void testReadSingleFrame(void) {
@@ -151,5 +380,1019 @@ DataOffset: 16777217\n\
 
         }
 
+        template<class C> void testMap(void) {
+            typedef datraw::info<C> info;
+            typedef datraw::raw_reader<C> raw_reader;
+
+            std::vector<std::uint16_t> expected(5 + 64 * 64 * 64);
+            std::generate(expected.begin(),
+                expected.end(),
+                [](void) {
+                return static_cast<std::uint16_t>(std::rand() % 65536);
+            });
+
+            {
+                std::fstream stream("test.raw", std::ios::out
+                    | std::ios::binary);
+                stream.write(reinterpret_cast<const char *>(expected.data()),
+                    expected.size() * sizeof(std::uint16_t));
+                stream.close();
+            }
+
+            expected.erase(expected.begin(), expected.begin() + 5);
+
+            {
+                auto dat = DATRAW_TPL_LITERAL(C, "\
+ObjectFileName: test.raw\n\
+Resolution: 64 64 64\n\
+Format: USHORT\n\
+GridType: CARTESIAN\n\
+DataOffset: 10\n\
+ByteOrder: LITTLE_ENDIAN\n\
+");
+
+                raw_reader reader(info::parse(dat));
+                auto view = reader.map_current();
+                Assert::AreEqual(expected.size() * sizeof(std::uint16_t), view.size(), L"View has the size of the data.", LINE_INFO());
+
+                auto actual = static_cast<const std::uint16_t *>(view.data());
+                Assert::IsTrue(std::equal(expected.begin(), expected.end(), actual), L"View exposes the data.", LINE_INFO());
+            }
+
+            {
+                auto dat = DATRAW_TPL_LITERAL(C, "\
+ObjectFileName: test.raw\n\
+Resolution: 64 64 64\n\
+Format: USHORT\n\
+GridType: CARTESIAN\n\
+DataOffset: 10\n\
+ByteOrder: BIG_ENDIAN\n\
+");
+
+                raw_reader reader(info::parse(dat));
+                auto view = reader.map(0);
+                Assert::AreEqual(expected.size() * sizeof(std::uint16_t), view.size(), L"View has the size of the data.", LINE_INFO());
+
+                datraw::swap_byte_order(expected.data(), expected.size());
+                auto actual = static_cast<const std::uint16_t *>(view.data());
+                Assert::IsTrue(std::equal(expected.begin(), expected.end(), actual), L"View exposes the swapped data.", LINE_INFO());
+
+                Assert::ExpectException<std::range_error>([&]() {
+                    auto v = reader.map(1);
+                }, L"Illegal time step is recognised.", LINE_INFO());
+            }
+        }
+
+        template<class C> void testReadRegion(void) {
+            typedef datraw::info<C> info;
+            typedef datraw::raw_reader<C> raw_reader;
+
+            const std::uint32_t sx = 16, sy = 12, sz = 10;
+            std::vector<std::uint16_t> volume(3 + sx * sy * sz);
+            std::generate(volume.begin(),
+                volume.end(),
+                [](void) {
+                return static_cast<std::uint16_t>(std::rand() % 65536);
+            });
+
+            {
+                std::fstream stream("test.raw", std::ios::out
+                    | std::ios::binary);
+                stream.write(reinterpret_cast<const char *>(volume.data()),
+                    volume.size() * sizeof(std::uint16_t));
+                stream.close();
+            }
+
+            volume.erase(volume.begin(), volume.begin() + 3);
+
+            auto dat = DATRAW_TPL_LITERAL(C, "\
+ObjectFileName: test.raw\n\
+Resolution: 16 12 10\n\
+Format: USHORT\n\
+GridType: CARTESIAN\n\
+DataOffset: 6\n\
+");
+
+            raw_reader reader(info::parse(dat));
+
+            auto testRegion = [&](const std::vector<std::uint32_t>& origin, const std::vector<std::uint32_t>& extent) {
+                std::vector<std::uint16_t> expected;
+                for (std::uint32_t z = origin[2]; z < origin[2] + extent[2]; ++z) {
+                    for (std::uint32_t y = origin[1]; y < origin[1] + extent[1]; ++y) {
+                        for (std::uint32_t x = origin[0]; x < origin[0] + extent[0]; ++x) {
+                            expected.push_back(volume[x + sx * (y + sy * z)]);
+                        }
+                    }
+                }
+
+                auto size = reader.read_region(origin, extent, nullptr, 0);
+                Assert::AreEqual(expected.size() * sizeof(std::uint16_t), size, L"Region size computed.", LINE_INFO());
+
+                std::vector<std::uint16_t> actual(expected.size());
+                reader.read_region(origin, extent, actual.data(), size);
+                Assert::IsTrue(expected == actual, L"Region read correctly.", LINE_INFO());
+            };
+
+            testRegion({ 0, 0, 0 }, { sx, sy, sz });
+            testRegion({ 3, 2, 1 }, { 5, 4, 3 });
+            testRegion({ 0, 4, 2 }, { sx, 3, 5 });
+            testRegion({ 15, 11, 9 }, { 1, 1, 1 });
+
+            Assert::ExpectException<std::invalid_argument>([&]() {
+                reader.read_region({ 10, 0, 0 }, { 7, 1, 1 }, nullptr, 0);
+            }, L"Region outside the volume is recognised.", LINE_INFO());
+
+            Assert::ExpectException<std::invalid_argument>([&]() {
+                reader.read_region({ 0, 0 }, { 1, 1 }, nullptr, 0);
+            }, L"Region with wrong dimensions is recognised.", LINE_INFO());
+        }
+
+        template<class C> void testReadSlice(void) {
+            typedef datraw::info<C> info;
+            typedef datraw::raw_reader<C> raw_reader;
+
+            const std::uint32_t res[] = { 17, 12, 10 };
+            std::vector<std::uint16_t> volume(res[0] * res[1] * res[2]);
+            std::generate(volume.begin(),
+                volume.end(),
+                [](void) {
+                return static_cast<std::uint16_t>(std::rand() % 65536);
+            });
+
+            {
+                std::fstream stream("test.raw", std::ios::out
+                    | std::ios::binary);
+                stream.write(reinterpret_cast<const char *>(volume.data()),
+                    volume.size() * sizeof(std::uint16_t));
+                stream.close();
+            }
+
+            auto dat = DATRAW_TPL_LITERAL(C, "\
+ObjectFileName: test.raw\n\
+Resolution: 17 12 10\n\
+Format: USHORT\n\
+GridType: CARTESIAN\n\
+ByteOrder: BIG_ENDIAN\n\
+");
+
+            raw_reader reader(info::parse(dat));
+            datraw::swap_byte_order(volume.data(), volume.size());
+
+            for (std::uint32_t axis = 0; axis < 3; ++axis) {
+                for (std::uint32_t index = 0; index < res[axis]; ++index) {
+                    std::vector<std::uint16_t> expected;
+                    std::uint32_t p[3];
+                    p[axis] = index;
+                    const auto a0 = (axis == 0) ? 1 : 0;
+                    const auto a1 = (axis == 2) ? 1 : 2;
+                    for (p[a1] = 0; p[a1] < res[a1]; ++p[a1]) {
+                        for (p[a0] = 0; p[a0] < res[a0]; ++p[a0]) {
+                            expected.push_back(volume[p[0] + res[0] * (p[1] + res[1] * p[2])]);
+                        }
+                    }
+
+                    auto size = reader.read_slice(axis, index, nullptr, 0);
+                    Assert::AreEqual(expected.size() * sizeof(std::uint16_t), size, L"Slice size computed.", LINE_INFO());
+
+                    std::vector<std::uint16_t> actual(expected.size());
+                    reader.read_slice(axis, index, actual.data(), size);
+                    Assert::IsTrue(expected == actual, L"Slice read correctly.", LINE_INFO());
+                }
+            }
+
+            Assert::ExpectException<std::invalid_argument>([&]() {
+                reader.read_slice(3, 0, nullptr, 0);
+            }, L"Invalid axis is recognised.", LINE_INFO());
+
+            Assert::ExpectException<std::invalid_argument>([&]() {
+                reader.read_slice(2, 10, nullptr, 0);
+            }, L"Invalid slice is recognised.", LINE_INFO());
+        }
+
+        template<class C> void testPrefetch(void) {
+            typedef datraw::info<C> info;
+            typedef datraw::prefetching_raw_reader<C> prefetching_raw_reader;
+            typedef datraw::raw_reader<C> raw_reader;
+
+            const auto cntTimeSteps = 5;
+            std::vector<std::vector<std::uint32_t>> expected(cntTimeSteps);
+
+            for (int t = 0; t < cntTimeSteps; ++t) {
+                expected[t].resize(32 * 32 * 32);
+                std::generate(expected[t].begin(),
+                    expected[t].end(),
+                    [](void) {
+                    return static_cast<std::uint32_t>(std::rand());
+                });
+
+                std::stringstream path;
+                path << "test" << t << ".raw";
+                std::fstream stream(path.str(), std::ios::out
+                    | std::ios::binary);
+                stream.write(reinterpret_cast<const char *>(expected[t].data()),
+                    expected[t].size() * sizeof(std::uint32_t));
+                stream.close();
+
+                datraw::swap_byte_order(expected[t].data(), expected[t].size());
+            }
+
+            auto dat = DATRAW_TPL_LITERAL(C, "\
+ObjectFileName: test%d.raw\n\
+TimeSteps: 5\n\
+Resolution: 32 32 32\n\
+Format: UINT\n\
+GridType: CARTESIAN\n\
+ByteOrder: BIG_ENDIAN\n\
+");
+
+            for (std::size_t depth = 0; depth < 4; ++depth) {
+                prefetching_raw_reader reader(raw_reader(info::parse(dat)), depth);
+                Assert::AreEqual(depth, reader.depth(), L"Prefetch depth is stored.", LINE_INFO());
+
+                std::size_t t = 0;
+                do {
+                    Assert::AreEqual(t, std::size_t(reader.current()), L"Current time step is tracked.", LINE_INFO());
+                    auto actual = reader.read_current();
+                    Assert::AreEqual(expected[t].size() * sizeof(std::uint32_t), actual.size(), L"Buffer has size of time step.", LINE_INFO());
+                    Assert::IsTrue(std::equal(expected[t].begin(), expected[t].end(), reinterpret_cast<const std::uint32_t *>(actual.data())), L"Prefetched data are correct.", LINE_INFO());
+
+                    actual = reader.read_current();
+                    Assert::IsTrue(std::equal(expected[t].begin(), expected[t].end(), reinterpret_cast<const std::uint32_t *>(actual.data())), L"Reading a consumed time step again is possible.", LINE_INFO());
+                    ++t;
+                } while (reader.move_next());
+                Assert::AreEqual(std::size_t(cntTimeSteps), t, L"All time steps have been read.", LINE_INFO());
+
+                Assert::ExpectException<std::range_error>([&]() {
+                    reader.read_current();
+                }, L"End of time series is recognised.", LINE_INFO());
+
+                Assert::IsTrue(reader.move_to(3), L"Move to time step 3.", LINE_INFO());
+                {
+                    auto actual = reader.read_current();
+                    Assert::IsTrue(std::equal(expected[3].begin(), expected[3].end(), reinterpret_cast<const std::uint32_t *>(actual.data())), L"Data after seek are correct.", LINE_INFO());
+                }
+
+                reader.reset();
+                {
+                    auto actual = reader.read_next();
+                    Assert::IsTrue(std::equal(expected[1].begin(), expected[1].end(), reinterpret_cast<const std::uint32_t *>(actual.data())), L"Data after reset are correct.", LINE_INFO());
+                }
+            }
+        }
+
+        template<class C> void testFileCache(void) {
+            typedef datraw::info<C> info;
+            typedef datraw::raw_reader<C> raw_reader;
+
+            auto write = [](const std::vector<std::uint8_t>& data) {
+                std::fstream stream("test.raw", std::ios::out
+                    | std::ios::binary | std::ios::trunc);
+                stream.write(reinterpret_cast<const char *>(data.data()),
+                    data.size());
+                stream.close();
+            };
+
+            auto dat = DATRAW_TPL_LITERAL(C, "\
+ObjectFileName: test.raw\n\
+Resolution: 16 16 16\n\
+Format: UCHAR\n\
+GridType: CARTESIAN\n\
+");
+
+            std::vector<std::uint8_t> expected(16 * 16 * 16);
+            std::iota(expected.begin(), expected.end(), 0);
+            write(expected);
+
+            raw_reader reader(info::parse(dat));
+            {
+                auto actual = reader.read_current();
+                Assert::IsTrue(expected == actual, L"Initial data are read.", LINE_INFO());
+            }
+            {
+                auto actual = reader.read_current();
+                Assert::IsTrue(expected == actual, L"Data are read again from cached file.", LINE_INFO());
+            }
+
+            std::reverse(expected.begin(), expected.end());
+            write(expected);
+            {
+                auto actual = reader.read_current();
+                Assert::IsTrue(expected == actual, L"Data rewritten in place are read.", LINE_INFO());
+            }
+
+            expected.resize(2 * expected.size(), 42);
+            write(expected);
+            {
+                auto actual = reader.read_current();
+                Assert::IsTrue(expected == actual, L"Size change is recognised.", LINE_INFO());
+            }
+
+            std::remove("test.raw");
+            expected.resize(expected.size() / 4, 7);
+            write(expected);
+            {
+                auto copy = reader;
+                auto actual = copy.read_current();
+                Assert::IsTrue(expected == actual, L"Replaced file is recognised.", LINE_INFO());
+            }
+
+            std::remove("test.raw");
+            Assert::ExpectException<std::invalid_argument>([&]() {
+                reader.read_current();
+            }, L"Deleted file is recognised.", LINE_INFO());
+
+            reader.clear_cache();
+            write(expected);
+            {
+                auto actual = reader.read_current();
+                Assert::IsTrue(expected == actual, L"Data are read after clearing the cache.", LINE_INFO());
+            }
+        }
+
+        template<class C> void testReadUninitialised(void) {
+            typedef datraw::info<C> info;
+            typedef datraw::raw_reader<C> raw_reader;
+
+            std::vector<std::uint16_t> expected(3 + 32 * 32 * 32);
+            std::generate(expected.begin(),
+                expected.end(),
+                [](void) {
+                return static_cast<std::uint16_t>(std::rand() % 65536);
+            });
+
+            {
+                std::fstream stream("test.raw", std::ios::out
+                    | std::ios::binary);
+                stream.write(reinterpret_cast<const char *>(expected.data()),
+                    expected.size() * sizeof(std::uint16_t));
+                stream.close();
+            }
+
+            expected.erase(expected.begin(), expected.begin() + 3);
+            datraw::swap_byte_order(expected.data(), expected.size());
+            const auto size = expected.size() * sizeof(std::uint16_t);
+
+            auto dat = DATRAW_TPL_LITERAL(C, "\
+ObjectFileName: test.raw\n\
+Resolution: 32 32 32\n\
+Format: USHORT\n\
+GridType: CARTESIAN\n\
+DataOffset: 6\n\
+ByteOrder: BIG_ENDIAN\n\
+");
+
+            raw_reader reader(info::parse(dat));
+
+            {
+                auto actual = reader.read_current(datraw::default_init_allocator<datraw::uint8>());
+                Assert::AreEqual(size, actual.size(), L"Vector has size of frame.", LINE_INFO());
+                Assert::IsTrue(std::equal(expected.begin(), expected.end(), reinterpret_cast<const std::uint16_t *>(actual.data())), L"Data in vector are correct.", LINE_INFO());
+            }
+
+            {
+                std::size_t actualSize = 0;
+                auto actual = reader.read_current(actualSize);
+                Assert::AreEqual(size, actualSize, L"Array has size of frame.", LINE_INFO());
+                Assert::IsTrue(std::equal(expected.begin(), expected.end(), reinterpret_cast<const std::uint16_t *>(actual.get())), L"Data in array are correct.", LINE_INFO());
+            }
+
+            reader.move_next();
+            Assert::ExpectException<std::range_error>([&]() {
+                std::size_t s;
+                reader.read_current(s);
+            }, L"End of time series is recognised.", LINE_INFO());
+        }
+
+        template<class C> void testForEachChunk(void) {
+            typedef datraw::info<C> info;
+            typedef datraw::raw_reader<C> raw_reader;
+
+            std::vector<std::uint32_t> expected(2 + 3 * 19 * 23 * 7);
+            std::generate(expected.begin(),
+                expected.end(),
+                [](void) {
+                return static_cast<std::uint32_t>(std::rand());
+            });
+
+            {
+                std::fstream stream("test.raw", std::ios::out
+                    | std::ios::binary);
+                stream.write(reinterpret_cast<const char *>(expected.data()),
+                    expected.size() * sizeof(std::uint32_t));
+                stream.close();
+            }
+
+            expected.erase(expected.begin(), expected.begin() + 2);
+            datraw::swap_byte_order(expected.data(), expected.size());
+            const auto size = expected.size() * sizeof(std::uint32_t);
+            const auto elementSize = 3 * sizeof(std::uint32_t);
+
+            auto dat = DATRAW_TPL_LITERAL(C, "\
+ObjectFileName: test.raw\n\
+Resolution: 19 23 7\n\
+Components: 3\n\
+Format: UINT\n\
+GridType: CARTESIAN\n\
+DataOffset: 8\n\
+ByteOrder: BIG_ENDIAN\n\
+");
+
+            raw_reader reader(info::parse(dat));
+
+            for (std::size_t chunkSize : { std::size_t(1), std::size_t(13), std::size_t(1000), size, 2 * size }) {
+                std::vector<std::uint8_t> actual;
+                auto retval = reader.for_each_chunk(chunkSize, [&](const void *data, const std::size_t cnt, const std::size_t offset) {
+                    Assert::AreEqual(actual.size(), offset, L"Chunks are passed in order.", LINE_INFO());
+                    Assert::IsTrue(cnt % elementSize == 0, L"Chunks hold full elements.", LINE_INFO());
+                    Assert::IsTrue(cnt <= (std::max)(chunkSize, elementSize), L"Chunks do not exceed the requested size.", LINE_INFO());
+                    auto d = static_cast<const std::uint8_t *>(data);
+                    actual.insert(actual.end(), d, d + cnt);
+                });
+
+                Assert::AreEqual(size, retval, L"Size of frame is returned.", LINE_INFO());
+                Assert::AreEqual(size, actual.size(), L"All chunks have been passed.", LINE_INFO());
+                Assert::IsTrue(std::equal(expected.begin(), expected.end(), reinterpret_cast<const std::uint32_t *>(actual.data())), L"Streamed data are correct.", LINE_INFO());
+            }
+        }
+
+        template<class C> void testReadRange(void) {
+            typedef datraw::info<C> info;
+            typedef datraw::raw_reader<C> raw_reader;
+
+            const auto cntTimeSteps = 7;
+            std::vector<std::vector<std::uint16_t>> expected(cntTimeSteps);
+
+            for (int t = 0; t < cntTimeSteps; ++t) {
+                expected[t].resize(24 * 24 * 24);
+                std::generate(expected[t].begin(),
+                    expected[t].end(),
+                    [](void) {
+                    return static_cast<std::uint16_t>(std::rand() % 65536);
+                });
+
+                std::stringstream path;
+                path << "test" << t << ".raw";
+                std::fstream stream(path.str(), std::ios::out
+                    | std::ios::binary);
+                stream.write(reinterpret_cast<const char *>(expected[t].data()),
+                    expected[t].size() * sizeof(std::uint16_t));
+                stream.close();
+
+                datraw::swap_byte_order(expected[t].data(), expected[t].size());
+            }
+
+            auto dat = DATRAW_TPL_LITERAL(C, "\
+ObjectFileName: test%d.raw\n\
+TimeSteps: 7\n\
+Resolution: 24 24 24\n\
+Format: USHORT\n\
+GridType: CARTESIAN\n\
+ByteOrder: BIG_ENDIAN\n\
+");
+
+            raw_reader reader(info::parse(dat));
+            const auto size = expected[0].size() * sizeof(std::uint16_t);
+
+            for (std::size_t concurrency = 0; concurrency < 4; ++concurrency) {
+                std::vector<std::vector<std::uint16_t>> actual(5, std::vector<std::uint16_t>(expected[0].size()));
+                std::vector<void *> dsts;
+                std::vector<std::size_t> cntDsts;
+                for (auto& a : actual) {
+                    dsts.push_back(a.data());
+                    cntDsts.push_back(a.size() * sizeof(std::uint16_t));
+                }
+                dsts[2] = nullptr;
+
+                auto sizes = reader.read_range(2, 5, dsts.data(), cntDsts.data(), concurrency);
+                Assert::AreEqual(std::size_t(5), sizes.size(), L"One size per time step.", LINE_INFO());
+                for (std::size_t i = 0; i < sizes.size(); ++i) {
+                    Assert::AreEqual(size, sizes[i], L"Size of time step is returned.", LINE_INFO());
+                    if (i != 2) {
+                        Assert::IsTrue(expected[2 + i] == actual[i], L"Time step has been read into buffer.", LINE_INFO());
+                    }
+                }
+            }
+
+            {
+                auto actual = reader.read_range(1, 6, 3);
+                Assert::AreEqual(std::size_t(6), actual.size(), L"One vector per time step.", LINE_INFO());
+                for (std::size_t i = 0; i < actual.size(); ++i) {
+                    Assert::AreEqual(size, actual[i].size(), L"Vector has size of time step.", LINE_INFO());
+                    Assert::IsTrue(std::equal(expected[1 + i].begin(), expected[1 + i].end(), reinterpret_cast<const std::uint16_t *>(actual[i].data())), L"Time step has been read into vector.", LINE_INFO());
+                }
+            }
+
+            Assert::IsTrue(reader.read_range(3, 0).empty(), L"Empty range is valid.", LINE_INFO());
+
+            Assert::ExpectException<std::range_error>([&]() {
+                reader.read_range(5, 3);
+            }, L"Range beyond end of time series is recognised.", LINE_INFO());
+        }
+
+        template<class C> void testReadAsync(void) {
+            typedef datraw::info<C> info;
+            typedef datraw::raw_reader<C> raw_reader;
+
+            const auto cntTimeSteps = 6;
+            std::vector<std::vector<std::uint16_t>> expected(cntTimeSteps);
+
+            for (int t = 0; t < cntTimeSteps; ++t) {
+                expected[t].resize(20 * 16 * 12);
+                std::generate(expected[t].begin(),
+                    expected[t].end(),
+                    [](void) {
+                    return static_cast<std::uint16_t>(std::rand() % 65536);
+                });
+
+                std::stringstream path;
+                path << "test" << t << ".raw";
+                std::fstream stream(path.str(), std::ios::out
+                    | std::ios::binary);
+                stream.write(reinterpret_cast<const char *>(expected[t].data()),
+                    expected[t].size() * sizeof(std::uint16_t));
+                stream.close();
+
+                datraw::swap_byte_order(expected[t].data(), expected[t].size());
+            }
+
+            auto dat = DATRAW_TPL_LITERAL(C, "\
+ObjectFileName: test%d.raw\n\
+TimeSteps: 6\n\
+Resolution: 20 16 12\n\
+Format: USHORT\n\
+GridType: CARTESIAN\n\
+ByteOrder: BIG_ENDIAN\n\
+");
+
+            raw_reader reader(info::parse(dat));
+            const auto size = expected[0].size() * sizeof(std::uint16_t);
+
+            {
+                std::vector<std::uint16_t> actual(expected[0].size());
+                auto future = reader.read_async(4, actual.data(), size);
+                Assert::AreEqual(size, future.get(), L"Size of time step is returned.", LINE_INFO());
+                Assert::IsTrue(expected[4] == actual, L"Time step has been read asynchronously.", LINE_INFO());
+
+                future = reader.read_async(4, nullptr, 0);
+                Assert::AreEqual(size, future.get(), L"Size can be queried asynchronously.", LINE_INFO());
+            }
+
+            {
+                std::vector<std::vector<std::uint16_t>> actual(cntTimeSteps, std::vector<std::uint16_t>(expected[0].size()));
+                std::vector<void *> dsts;
+                std::vector<std::size_t> cntDsts;
+                for (auto& a : actual) {
+                    dsts.push_back(a.data());
+                    cntDsts.push_back(size);
+                }
+
+                auto futures = reader.read_range_async(0, cntTimeSteps, dsts.data(), cntDsts.data());
+                Assert::AreEqual(std::size_t(cntTimeSteps), futures.size(), L"One future per time step.", LINE_INFO());
+                for (std::size_t i = 0; i < futures.size(); ++i) {
+                    Assert::AreEqual(size, futures[i].get(), L"Size of time step is returned.", LINE_INFO());
+                    Assert::IsTrue(expected[i] == actual[i], L"Batch has been read asynchronously.", LINE_INFO());
+                }
+            }
+
+            {
+                reader.move_to(2);
+                const std::vector<std::uint32_t> origin = { 3, 5, 1 };
+                const std::vector<std::uint32_t> extent = { 11, 7, 9 };
+                std::vector<std::uint8_t> expectedRegion(reader.read_region(origin, extent, nullptr, 0));
+                reader.read_region(origin, extent, expectedRegion.data(), expectedRegion.size());
+
+                std::vector<std::uint8_t> actual(expectedRegion.size());
+                auto future = reader.read_region_async(origin, extent, actual.data(), actual.size());
+                Assert::AreEqual(expectedRegion.size(), future.get(), L"Size of region is returned.", LINE_INFO());
+                Assert::IsTrue(expectedRegion == actual, L"Region has been read asynchronously.", LINE_INFO());
+            }
+
+            Assert::ExpectException<std::range_error>([&]() {
+                reader.read_async(cntTimeSteps, nullptr, 0);
+            }, L"Illegal time step is recognised.", LINE_INFO());
+        }
+
+        template<class C> void testDirectIo(void) {
+            typedef datraw::info<C> info;
+            typedef datraw::raw_reader<C> raw_reader;
+
+            const auto offset = 100;
+            std::vector<std::uint16_t> expected(33 * 17 * 9);
+            std::generate(expected.begin(),
+                expected.end(),
+                [](void) {
+                return static_cast<std::uint16_t>(std::rand() % 65536);
+            });
+
+            {
+                std::vector<char> header(offset, 42);
+                std::fstream stream("test.raw", std::ios::out
+                    | std::ios::binary);
+                stream.write(header.data(), header.size());
+                stream.write(reinterpret_cast<const char *>(expected.data()),
+                    expected.size() * sizeof(std::uint16_t));
+                stream.close();
+            }
+
+            datraw::swap_byte_order(expected.data(), expected.size());
+
+            auto dat = DATRAW_TPL_LITERAL(C, "\
+ObjectFileName: test.raw\n\
+Resolution: 33 17 9\n\
+Format: USHORT\n\
+GridType: CARTESIAN\n\
+ByteOrder: BIG_ENDIAN\n\
+DataOffset: 100\n\
+");
+
+            raw_reader reader(info::parse(dat));
+            Assert::IsFalse(reader.direct_io(), L"Direct I/O is disabled by default.", LINE_INFO());
+            reader.direct_io(true);
+            Assert::IsTrue(reader.direct_io(), L"Direct I/O has been enabled.", LINE_INFO());
+
+            {
+                auto actual = reader.read_current();
+                Assert::AreEqual(expected.size() * sizeof(std::uint16_t), actual.size(), L"Size of frame is correct.", LINE_INFO());
+                Assert::IsTrue(std::memcmp(expected.data(), actual.data(), actual.size()) == 0, L"Frame has been read directly.", LINE_INFO());
+            }
+
+            {
+                auto actual = reader.map_current();
+                Assert::AreEqual(expected.size() * sizeof(std::uint16_t), actual.size(), L"Size of view is correct.", LINE_INFO());
+                Assert::IsTrue(std::memcmp(expected.data(), actual.data(), actual.size()) == 0, L"View has been read directly.", LINE_INFO());
+            }
+
+            {
+                const std::vector<std::uint32_t> origin = { 3, 5, 1 };
+                const std::vector<std::uint32_t> extent = { 11, 7, 6 };
+                std::vector<std::uint8_t> actual(reader.read_region(origin, extent, nullptr, 0));
+                reader.read_region(origin, extent, actual.data(), actual.size());
+
+                reader.direct_io(false);
+                std::vector<std::uint8_t> buffered(actual.size());
+                reader.read_region(origin, extent, buffered.data(), buffered.size());
+                reader.direct_io(true);
+                Assert::IsTrue(buffered == actual, L"Region has been read directly.", LINE_INFO());
+            }
+
+            {
+                std::vector<std::uint16_t> actual(expected.size());
+                auto future = reader.read_async(0, actual.data(), actual.size() * sizeof(std::uint16_t));
+                future.get();
+                Assert::IsTrue(expected == actual, L"Frame has been read asynchronously.", LINE_INFO());
+            }
+        }
+
+        template<class C> void testStrictGeometry(void) {
+            typedef datraw::info<C> info;
+            typedef datraw::raw_reader<C> raw_reader;
+
+            std::vector<std::uint16_t> expected(16 * 8 * 4 * 2);
+            std::generate(expected.begin(),
+                expected.end(),
+                [](void) {
+                return static_cast<std::uint16_t>(std::rand() % 65536);
+            });
+
+            {
+                std::vector<char> trailer(40, 42);
+                std::fstream stream("test.raw", std::ios::out
+                    | std::ios::binary);
+                stream.write(reinterpret_cast<const char *>(expected.data()),
+                    expected.size() * sizeof(std::uint16_t));
+                stream.write(trailer.data(), trailer.size());
+                stream.close();
+            }
+
+            auto dat = DATRAW_TPL_LITERAL(C, "\
+ObjectFileName: test.raw\n\
+Resolution: 16 8 4\n\
+Format: USHORT\n\
+Components: 2\n\
+GridType: CARTESIAN\n\
+ByteOrder: LITTLE_ENDIAN\n\
+");
+
+            raw_reader reader(info::parse(dat));
+            const auto frameSize = expected.size() * sizeof(std::uint16_t);
+            Assert::AreEqual(frameSize, reader.info().frame_size(), L"Frame size is computed from the geometry.", LINE_INFO());
+            Assert::AreEqual(frameSize + 40, reader.read_current(nullptr, 0), L"Whole file is read by default.", LINE_INFO());
+
+            Assert::IsFalse(reader.strict_geometry(), L"Strict geometry is disabled by default.", LINE_INFO());
+            reader.strict_geometry(true);
+            Assert::IsTrue(reader.strict_geometry(), L"Strict geometry has been enabled.", LINE_INFO());
+
+            {
+                auto actual = reader.read_current();
+                Assert::AreEqual(frameSize, actual.size(), L"Only the volume is read.", LINE_INFO());
+                Assert::IsTrue(std::memcmp(expected.data(), actual.data(), actual.size()) == 0, L"Volume has been read.", LINE_INFO());
+            }
+
+            {
+                auto actual = reader.map_current();
+                Assert::AreEqual(frameSize, actual.size(), L"Only the volume is mapped.", LINE_INFO());
+            }
+
+            {
+                std::remove("test.raw");
+                Assert::AreEqual(frameSize, reader.read_current(nullptr, 0), L"Size is known without the file.", LINE_INFO());
+            }
+
+            {
+                std::fstream stream("test.raw", std::ios::out
+                    | std::ios::binary);
+                stream.write(reinterpret_cast<const char *>(expected.data()),
+                    frameSize - 2);
+                stream.close();
+            }
+
+            reader.clear_cache();
+            Assert::ExpectException<std::invalid_argument>([&]() {
+                reader.read_current();
+            }, L"Truncated file is rejected.", LINE_INFO());
+        }
+
+        template<class C> void testReadAs(void) {
+            typedef datraw::info<C> info;
+            typedef datraw::raw_reader<C> raw_reader;
+
+            // Make the frame larger than the staging buffer.
+            std::vector<std::uint16_t> data(300 * 1000);
+            std::generate(data.begin(),
+                data.end(),
+                [](void) {
+                return static_cast<std::uint16_t>(std::rand() % 65536);
+            });
+
+            {
+                std::fstream stream("test.raw", std::ios::out
+                    | std::ios::binary);
+                stream.write(reinterpret_cast<const char *>(data.data()),
+                    data.size() * sizeof(std::uint16_t));
+                stream.close();
+            }
+
+            auto dat = DATRAW_TPL_LITERAL(C, "\
+ObjectFileName: test.raw\n\
+Resolution: 300 1000 1\n\
+Format: USHORT\n\
+GridType: CARTESIAN\n\
+ByteOrder: BIG_ENDIAN\n\
+");
+
+            raw_reader reader(info::parse(dat));
+            auto swapped = data;
+            datraw::swap_byte_order(swapped.data(), swapped.size());
+
+            Assert::AreEqual(data.size(), reader.read_current_as(static_cast<float *>(nullptr), 0), L"Number of scalars is returned.", LINE_INFO());
+
+            {
+                std::vector<float> expected(swapped.size());
+                datraw::convert<float>(swapped.begin(), swapped.end(), expected.begin());
+
+                std::vector<float> actual(data.size());
+                Assert::AreEqual(data.size(), reader.read_current_as(actual.data(), actual.size()), L"Number of scalars is returned.", LINE_INFO());
+                Assert::IsTrue(expected == actual, L"Data have been swapped and converted.", LINE_INFO());
+            }
+
+            {
+                std::vector<std::uint8_t> expected(swapped.size());
+                datraw::convert<std::uint8_t>(swapped.begin(), swapped.end(), expected.begin());
+
+                std::vector<std::uint8_t> actual(data.size());
+                reader.read_current_as(actual.data(), actual.size());
+                Assert::IsTrue(expected == actual, L"Data have been swapped and narrowed.", LINE_INFO());
+            }
+
+            {
+                std::vector<std::uint16_t> actual(data.size());
+                reader.read_current_as(actual.data(), actual.size());
+                Assert::IsTrue(swapped == actual, L"Data have been swapped in place.", LINE_INFO());
+            }
+
+            {
+                std::vector<float> actual(data.size() - 1, -1.0f);
+                reader.read_current_as(actual.data(), actual.size());
+                Assert::AreEqual(-1.0f, actual.front(), L"Nothing is written to small buffer.", LINE_INFO());
+            }
+
+            {
+                // Apply a window of [16384, 49151] via a custom table.
+                auto window = [](const std::uint16_t v) {
+                    auto f = (static_cast<float>(v) - 16384.0f) / 32767.0f;
+                    return (std::min)((std::max)(f, 0.0f), 1.0f);
+                };
+                auto table = datraw::lookup_table<std::uint16_t, float>::make(window);
+
+                std::vector<float> actual(data.size());
+                Assert::AreEqual(data.size(), reader.read_current_as(table, actual.data(), actual.size()), L"Number of scalars is returned.", LINE_INFO());
+                for (std::size_t i = 0; i < swapped.size(); ++i) {
+                    Assert::AreEqual(window(swapped[i]), actual[i], L"Window has been applied.", LINE_INFO());
+                }
+
+                datraw::lookup_table<std::int16_t, float> wrongTable;
+                Assert::ExpectException<std::runtime_error>([&]() {
+                    reader.read_current_as(wrongTable, actual.data(), actual.size());
+                }, L"Table for wrong source type is rejected.", LINE_INFO());
+            }
+        }
+
+        template<class C> void testAccessPolicy(void) {
+            typedef datraw::info<C> info;
+            typedef datraw::raw_reader<C> raw_reader;
+
+            const auto cntTimeSteps = 4;
+            std::vector<std::vector<std::uint8_t>> expected(cntTimeSteps);
+
+            for (int t = 0; t < cntTimeSteps; ++t) {
+                expected[t].resize(32 * 16 * 8);
+                std::generate(expected[t].begin(),
+                    expected[t].end(),
+                    [](void) {
+                    return static_cast<std::uint8_t>(std::rand() % 256);
+                });
+
+                std::stringstream path;
+                path << "test" << t << ".raw";
+                std::fstream stream(path.str(), std::ios::out
+                    | std::ios::binary);
+                stream.write(reinterpret_cast<const char *>(expected[t].data()),
+                    expected[t].size());
+                stream.close();
+            }
+
+            auto dat = DATRAW_TPL_LITERAL(C, "\
+ObjectFileName: test%d.raw\n\
+TimeSteps: 4\n\
+Resolution: 32 16 8\n\
+Format: UCHAR\n\
+GridType: CARTESIAN\n\
+");
+
+            raw_reader reader(info::parse(dat));
+            Assert::IsTrue(reader.access_policy() == datraw::access_pattern::normal, L"Access pattern is normal by default.", LINE_INFO());
+
+            reader.access_policy(datraw::access_pattern::sequential);
+            Assert::IsTrue(reader.access_policy() == datraw::access_pattern::sequential, L"Access pattern has been changed.", LINE_INFO());
+
+            for (int t = 0; reader; ++t) {
+                Assert::IsTrue(expected[t] == reader.read_current(), L"Time step has been read sequentially.", LINE_INFO());
+                auto view = reader.map_current();
+                Assert::IsTrue(std::equal(view.begin(), view.end(), expected[t].begin()), L"Time step has been mapped sequentially.", LINE_INFO());
+                reader.move_next();
+            }
+
+            reader.access_policy(datraw::access_pattern::random);
+            reader.move_to(2);
+            Assert::IsTrue(expected[2] == reader.read_current(), L"Time step has been read randomly.", LINE_INFO());
+
+            reader.access_policy(datraw::access_pattern::region);
+            const std::vector<std::uint32_t> origin = { 4, 4, 4 };
+            const std::vector<std::uint32_t> extent = { 1, 1, 1 };
+            std::uint8_t voxel;
+            reader.read_region(origin, extent, &voxel, 1);
+            Assert::AreEqual(expected[2][4 + 4 * 32 + 4 * 32 * 16], voxel, L"Voxel has been read in region mode.", LINE_INFO());
+        }
+
+        template<class C> void testReadTimeRange(void) {
+            typedef datraw::info<C> info;
+            typedef datraw::raw_reader<C> raw_reader;
+
+            const auto cntTimeSteps = 5;
+            std::vector<std::vector<std::uint32_t>> expected(cntTimeSteps);
+
+            for (int t = 0; t < cntTimeSteps; ++t) {
+                expected[t].resize(8 * 4 * 2);
+                std::generate(expected[t].begin(),
+                    expected[t].end(),
+                    [](void) {
+                    return static_cast<std::uint32_t>(std::rand());
+                });
+
+                std::stringstream path;
+                path << "test" << t << ".raw";
+                std::fstream stream(path.str(), std::ios::out
+                    | std::ios::binary);
+                stream.write(reinterpret_cast<const char *>(expected[t].data()),
+                    expected[t].size() * sizeof(std::uint32_t));
+                stream.close();
+
+                datraw::swap_byte_order(expected[t].data(), expected[t].size());
+            }
+
+            auto dat = DATRAW_TPL_LITERAL(C, "\
+ObjectFileName: test%d.raw\n\
+TimeSteps: 5\n\
+Resolution: 8 4 2\n\
+Format: UINT\n\
+GridType: CARTESIAN\n\
+ByteOrder: BIG_ENDIAN\n\
+");
+
+            raw_reader reader(info::parse(dat));
+            const auto frameSize = expected[0].size() * sizeof(std::uint32_t);
+
+            {
+                const auto size = reader.read_time_range(1, 3, nullptr, 0);
+                Assert::AreEqual(3 * frameSize, size, L"Frames are packed by default.", LINE_INFO());
+
+                std::vector<std::uint32_t> actual(size / sizeof(std::uint32_t));
+                Assert::AreEqual(size, reader.read_time_range(1, 3, actual.data(), size, 0, 2), L"Size is returned.", LINE_INFO());
+
+                for (std::size_t i = 0; i < 3; ++i) {
+                    Assert::IsTrue(std::equal(expected[1 + i].begin(), expected[1 + i].end(), actual.begin() + i * expected[0].size()), L"Frame has been read into its slot.", LINE_INFO());
+                }
+            }
+
+            {
+                const auto pitch = frameSize + 64;
+                const auto size = reader.read_time_range(0, cntTimeSteps, nullptr, 0, pitch);
+                Assert::AreEqual((cntTimeSteps - 1) * pitch + frameSize, size, L"Size accounts for the pitch.", LINE_INFO());
+
+                std::vector<std::uint8_t> actual(size, 42);
+                reader.read_time_range(0, cntTimeSteps, actual.data(), actual.size(), pitch);
+
+                for (std::size_t i = 0; i < cntTimeSteps; ++i) {
+                    Assert::IsTrue(std::memcmp(expected[i].data(), actual.data() + i * pitch, frameSize) == 0, L"Frame has been read into pitched slot.", LINE_INFO());
+                    if (i + 1 < cntTimeSteps) {
+                        Assert::AreEqual(std::uint8_t(42), actual[i * pitch + frameSize], L"Padding is not written.", LINE_INFO());
+                    }
+                }
+            }
+
+            Assert::ExpectException<std::invalid_argument>([&]() {
+                reader.read_time_range(0, 2, nullptr, 0, frameSize - 4);
+            }, L"Pitch smaller than frame is rejected.", LINE_INFO());
+
+            Assert::ExpectException<std::range_error>([&]() {
+                reader.read_time_range(3, 3, nullptr, 0);
+            }, L"Range beyond series is rejected.", LINE_INFO());
+        }
+
+        template<class C> void testReadPitched(void) {
+            typedef datraw::info<C> info;
+            typedef datraw::raw_reader<C> raw_reader;
+
+            const std::size_t x = 5, y = 3, z = 4;
+            std::vector<std::uint16_t> expected(x * y * z);
+            std::iota(expected.begin(), expected.end(), std::uint16_t(1));
+
+            {
+                std::fstream stream("test.raw", std::ios::out | std::ios::binary);
+                stream.write(reinterpret_cast<const char *>(expected.data()), expected.size() * sizeof(std::uint16_t));
+                stream.close();
+            }
+
+            datraw::swap_byte_order(expected.data(), expected.size());
+
+            auto dat = DATRAW_TPL_LITERAL(C, "\
+ObjectFileName: test.raw\n\
+Resolution: 5 3 4\n\
+Format: USHORT\n\
+GridType: CARTESIAN\n\
+ByteOrder: BIG_ENDIAN\n\
+");
+
+            raw_reader reader(info::parse(dat));
+            const auto rowSize = x * sizeof(std::uint16_t);
+            const auto rowPitch = reader.info().row_pitch(16);
+            Assert::AreEqual(std::size_t(16), rowPitch, L"Row pitch is aligned.", LINE_INFO());
+
+            {
+                const auto size = reader.read_pitched(0, 0, nullptr, 0);
+                Assert::AreEqual(expected.size() * sizeof(std::uint16_t), size, L"Zero pitches yield a dense frame.", LINE_INFO());
+
+                std::vector<std::uint16_t> actual(expected.size());
+                reader.read_pitched(0, 0, actual.data(), size);
+                Assert::IsTrue(expected == actual, L"Dense frame matches.", LINE_INFO());
+            }
+
+            {
+                const auto slicePitch = y * rowPitch + 32;
+                const auto size = reader.read_pitched(rowPitch, slicePitch, nullptr, 0);
+                Assert::AreEqual((z - 1) * slicePitch + (y - 1) * rowPitch + rowSize, size, L"Size accounts for both pitches.", LINE_INFO());
+
+                std::vector<std::uint8_t> actual(size, 42);
+                Assert::AreEqual(size, reader.read_pitched(rowPitch, slicePitch, actual.data(), actual.size()), L"Size is returned.", LINE_INFO());
+
+                for (std::size_t k = 0; k < z; ++k) {
+                    for (std::size_t j = 0; j < y; ++j) {
+                        const auto o = k * slicePitch + j * rowPitch;
+                        Assert::IsTrue(std::memcmp(expected.data() + (k * y + j) * x, actual.data() + o, rowSize) == 0, L"Row has been read into its slot.", LINE_INFO());
+                        if ((k + 1 < z) || (j + 1 < y)) {
+                            Assert::AreEqual(std::uint8_t(42), actual[o + rowSize], L"Padding is not written.", LINE_INFO());
+                        }
+                    }
+                }
+            }
+
+            Assert::ExpectException<std::invalid_argument>([&]() {
+                reader.read_pitched(rowSize - 2, 0, nullptr, 0);
+            }, L"Row pitch smaller than row is rejected.", LINE_INFO());
+
+            Assert::ExpectException<std::invalid_argument>([&]() {
+                reader.read_pitched(rowPitch, rowPitch, nullptr, 0);
+            }, L"Slice pitch smaller than slice is rejected.", LINE_INFO());
+        }
     };
 }
@@ -0,0 +1,62 @@
+﻿// <copyright file="visit_scalar.cpp" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2026 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#include "stdafx.h"
+#include "CppUnitTest.h"
+
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+
+namespace test {
+
+    TEST_CLASS(VisitScalar) {
+
+    public:
+
+        TEST_METHOD(TestComponents) {
+            for (std::size_t c = 1; c <= 4; ++c) {
+                auto actual = datraw::visit_scalar(datraw::scalar_type::uint16, c, [](const auto tag, const auto components) {
+                    typedef typename decltype(tag)::type type;
+                    return sizeof(type) * decltype(components)::value;
+                });
+                Assert::AreEqual(2 * c, actual, L"Components passed as constant.", LINE_INFO());
+            }
+
+            Assert::ExpectException<std::invalid_argument>([&]() {
+                datraw::visit_scalar(datraw::scalar_type::uint16, 5, [](const auto, const auto) { });
+            }, L"Unsupported number of components.", LINE_INFO());
+        }
+
+        TEST_METHOD(TestScalarTypes) {
+            this->testScalarType<datraw::scalar_type::int8>();
+            this->testScalarType<datraw::scalar_type::int16>();
+            this->testScalarType<datraw::scalar_type::int32>();
+            this->testScalarType<datraw::scalar_type::int64>();
+            this->testScalarType<datraw::scalar_type::uint8>();
+            this->testScalarType<datraw::scalar_type::uint16>();
+            this->testScalarType<datraw::scalar_type::uint32>();
+            this->testScalarType<datraw::scalar_type::uint64>();
+            this->testScalarType<datraw::scalar_type::float16>();
+            this->testScalarType<datraw::scalar_type::float32>();
+            this->testScalarType<datraw::scalar_type::float64>();
+
+            Assert::ExpectException<std::invalid_argument>([&]() {
+                datraw::visit_scalar(datraw::scalar_type::raw, [](const auto) { });
+            }, L"Raw data cannot be visited.", LINE_INFO());
+        }
+
+    private:
+
+        template<datraw::scalar_type T> void testScalarType(void) {
+            auto actual = datraw::visit_scalar(T, [](const auto tag) {
+                Assert::IsTrue(std::is_same<datraw::scalar_t<decltype(tag)::value>, typename decltype(tag)::type>::value, L"Tag is consistent.", LINE_INFO());
+                return decltype(tag)::value;
+            });
+            Assert::IsTrue(T == actual, L"Functor called for matching tag.", LINE_INFO());
+        }
+    };
+}